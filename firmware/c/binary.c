@@ -4,6 +4,7 @@
 #include "cpu.h"
 #include "errors.h"
 #include "firmware.h"
+#include "sercmd.h"
 #include "string.h"
 #include "trace.h"
 #include "utils.h"
@@ -23,11 +24,17 @@
 //
 // The response starts with an error code, followed by a cksum
 // byte, followed by data.
+//
+// When a channel is using the version 2 framing (see sercmd.c) the
+// frame carries its own CRC, so the checksum byte isn't checked and
+// the command is passed straight to DispatchBinaryCmd.
 
 // local functions
 static uint8_t Cksum( uint8_t *cmd, int len );
 static int HandlePeek( uint8_t *cmd, int len, int max );
 static int HandlePoke( uint8_t *cmd, int len, int max );
+static int HandleSetProto( uint8_t *cmd, int len, int max );
+static int HandleReadBulk( uint8_t *cmd, int len, int max );
 
 // Process a binary serial command.
 // Returns the length of the response.
@@ -39,63 +46,81 @@ int ProcessBinaryCmd( uint8_t *cmd, int len, int max )
    if( max < MIN_BUFFER_LEN )
       return 0;
 
-   int err = 0;
-
    if( len < 2 )
-      err = ERR_SHORT_CMD;
+      return ReturnErr( cmd, ERR_SHORT_CMD );
 
-   else if( Cksum( cmd, len ) != 0x55 )
-      err = ERR_CKSUM;
+   if( Cksum( cmd, len ) != 0x55 )
+      return ReturnErr( cmd, ERR_CKSUM );
 
-   else
+   return DispatchBinaryCmd( cmd, len, max );
+}
+
+// Pass a binary command to its handler without checking
+// the checksum byte.
+// Returns the length of the response.
+int DispatchBinaryCmd( uint8_t *cmd, int len, int max )
+{
+   if( max < MIN_BUFFER_LEN )
+      return 0;
+
+   if( len < 2 )
+      return ReturnErr( cmd, ERR_SHORT_CMD );
+
+   switch( cmd[0] )
    {
-      switch( cmd[0] )
-      {
-         // Indicate whether we're running in boot mode or normal mode
-         case CMD_STATE:
-            #ifdef BOOT
-               cmd[2] = 1;
-            #else
-               cmd[2] = 0;
-            #endif
-            return AddCksum( cmd, 1 );
+      // Indicate whether we're running in boot mode or normal mode
+      case CMD_STATE:
+         #ifdef BOOT
+            cmd[2] = 1;
+         #else
+            cmd[2] = 0;
+         #endif
+         return AddCksum( cmd, 1 );
 
-         case CMD_PEEK:
-            return HandlePeek( cmd, len, max );
+      case CMD_PEEK:
+         return HandlePeek( cmd, len, max );
 
-         case CMD_POKE:
-            return HandlePoke( cmd, len, max );
+      case CMD_POKE:
+         return HandlePoke( cmd, len, max );
 
-         case CMD_SWAP:
-            SwapMode();
-            return 0;
+      case CMD_SWAP:
+         SwapMode();
+         return 0;
 
 #ifdef BOOT
-         case CMD_ERASE_FW:
-            return HandleFwErase( cmd, len, max );
+      case CMD_ERASE_FW:
+         return HandleFwErase( cmd, len, max );
 
-         case CMD_WRITE_FW:
-            return HandleFwWrite( cmd, len, max );
+      case CMD_WRITE_FW:
+         return HandleFwWrite( cmd, len, max );
 
-         case OP_SAVE_FWCRC:
-            return HandleFwCRC( cmd, len, max );
+      case OP_SAVE_FWCRC:
+         return HandleFwCRC( cmd, len, max );
 #endif
-         case CMD_GET:
-            return HandleVarGet( cmd, len, max );
+      case CMD_GET:
+         return HandleVarGet( cmd, len, max );
 
-         case CMD_SET:
-            return HandleVarSet( cmd, len, max );
+      case CMD_SET:
+         return HandleVarSet( cmd, len, max );
 
-         default:
-            err = ERR_BAD_CMD;
-            break;
-      }
-   }
+      case CMD_GET_PART:
+         return HandleVarGetPart( cmd, len, max );
+
+      case CMD_SET_PART:
+         return HandleVarSetPart( cmd, len, max );
+
+      case CMD_LIST_VARS:
+         return HandleVarList( cmd, len, max );
+
+      case CMD_SET_PROTO:
+         return HandleSetProto( cmd, len, max );
 
-   if( err )
-      return ReturnErr( cmd, err );
+      case CMD_READ_BULK:
+         return HandleReadBulk( cmd, len, max );
 
-   return 0;
+      default:
+         return ReturnErr( cmd, ERR_BAD_CMD );
+   }
 }
 
 static uint8_t Cksum( uint8_t *cmd, int len )
@@ -220,3 +245,52 @@ static int HandlePoke( uint8_t *cmd, int len, int max )
 
    return ReturnErr( cmd, ERR_OK );
 }
+
+// Select the framing used on the channel this command arrived on.
+// The only data byte is the protocol version, 1 or 2.
+// The switch itself is done by the serial command module once
+// the response has been sent, so the response always goes out
+// using the old framing.
+//
+// The response holds the selected version and the number of
+// commands the channel can queue when using version 2.  The host
+// shouldn't have more commands outstanding then that.
+static int HandleSetProto( uint8_t *cmd, int len, int max )
+{
+   if( len < 3 )
+      return ReturnErr( cmd, ERR_SHORT_CMD );
+
+   if( (cmd[2] < 1) || (cmd[2] > 2) )
+      return ReturnErr( cmd, ERR_RANGE );
+
+   cmd[3] = SERCMD_QUEUE_LEN;
+   return AddCksum( cmd, 2 );
+}
+
+// Read a block of memory of any length.
+// Data passed is a 32-bit address and a 32-bit number of bytes.
+// The response holds the address and count actually used, and the
+// memory itself follows in a series of frames sent by the serial
+// command module (see sercmd.c).
+//
+// Unlike peek, the data is read a byte at a time, so this is
+// meant for RAM and flash rather then peripheral registers.
+static int HandleReadBulk( uint8_t *cmd, int len, int max )
+{
+   // Command byte, cksum byte, 4 address bytes and 4 count bytes.
+   if( len < 10 )
+      return ReturnErr( cmd, ERR_MISSING_DATA );
+
+   uint32_t addr = b2u32( &cmd[2] );
+   uint32_t ct   = b2u32( &cmd[6] );
+
+   // Same offset into RAM as peek uses for small addresses
+   if( addr < 0x80 ) addr += 0x20000000;
+
+   if( !ct || (addr + ct < addr) )
+      return ReturnErr( cmd, ERR_RANGE );
+
+   u32_2_u8( addr, &cmd[2] );
+   u32_2_u8( ct, &cmd[6] );
+   return AddCksum( cmd, 8 );
+}
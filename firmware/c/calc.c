@@ -2,18 +2,39 @@
 
 #include "calc.h"
 #include "cpu.h"
+#include "loop.h"
 #include "pressure.h"
 #include "utils.h"
 
+// local functions
+static void UpdateVolume( void );
+
 // History of readings, used to display graphs.
 #define MS_PER_HIST_SAMP    30
 #define HIST_LEN            128  // Must be 2^n
 static float presHist[ HIST_LEN ];
 static float flowHist[ HIST_LEN ];
 static uint8_t histNdx;
+static volatile uint32_t histSeq;
 static uint8_t histCt;
 static float presSum, flowSum;
 
+// Pressure / volume points for the current and previous breath, used
+// for the PV loop display.  Volume is found by integrating the flow
+// from the start of each breath.  A breath starts when the flow goes
+// above BREATH_FLOW_ON after having gone below BREATH_FLOW_OFF.
+#define MS_PER_PV_POINT     20
+#define BREATH_FLOW_ON      50.0     // ml/sec
+#define BREATH_FLOW_OFF     -10.0    // ml/sec
+static PVPoint pvPts[2][ PV_MAX_POINTS ];
+static volatile uint16_t pvCt[2];
+static volatile uint8_t pvCur;
+static volatile uint32_t breathCt;
+static uint8_t pvTime;
+static uint8_t inhaling;
+static float volume, maxVolume;
+static float tidalVol;
+
 
 void UpdateCalculations( void )
 {
@@ -22,20 +43,88 @@ void UpdateCalculations( void )
    flowSum += GetFlowRate();
    if( ++histCt >= MS_PER_HIST_SAMP )
    {
-      histNdx = (histNdx+1) & (HIST_LEN-1);
+      histNdx = (histSeq+1) & (HIST_LEN-1);
 
       presHist[ histNdx ] = presSum / MS_PER_HIST_SAMP;
       flowHist[ histNdx ] = flowSum / MS_PER_HIST_SAMP;
       histCt = 0;
       presSum = 0;
       flowSum = 0;
+      histSeq++;
+   }
+
+   UpdateVolume();
+}
+
+// Integrate the flow to find the volume delivered so far in this breath
+// and add a new point to the PV loop data every MS_PER_PV_POINT.
+// Called from the loop interrupt.
+static void UpdateVolume( void )
+{
+   float flow = GetFlowRate();
+
+   if( flow < BREATH_FLOW_OFF )
+      inhaling = 0;
+
+   else if( !inhaling && (flow > BREATH_FLOW_ON) )
+   {
+      // New breath.  The current point list becomes the
+      // previous one and the oldest one is reused.
+      inhaling = 1;
+      tidalVol = maxVolume;
+      volume = 0;
+      maxVolume = 0;
+      pvTime = 0;
+
+      int n = pvCur ^ 1;
+      pvCt[n] = 0;
+      pvCur = n;
+      breathCt++;
    }
+
+   volume += flow * (1.0 / LOOP_FREQ);
+   if( volume > maxVolume )
+      maxVolume = volume;
+
+   if( ++pvTime < MS_PER_PV_POINT )
+      return;
+   pvTime = 0;
+
+   int n = pvCur;
+   int ct = pvCt[n];
+   if( ct >= PV_MAX_POINTS )
+      return;
+
+   PVPoint *pt = &pvPts[n][ct];
+   pt->pres = Clip16( GetPressure1() * (PRESSURE_CM_H2O * 10) );
+   pt->vol  = Clip16( volume * 10 );
+   pvCt[n] = ct+1;
+}
+
+// Return the number of breaths seen so far
+uint32_t GetBreathCount( void )
+{
+   return breathCt;
+}
+
+// Get the PV loop points for the current (prev=0) or previous breath.
+// A pointer to the points is returned and the number of them is
+// stored in ct.  Points are only ever added to the current breath, so
+// the ones returned stay valid until the next breath starts.  Check
+// the breath count before and after reading them to be sure.
+const PVPoint *GetPVPoints( int prev, int *ct )
+{
+   int p = IntSuspend();
+   int n = prev ? pvCur^1 : pvCur;
+   *ct = pvCt[n];
+   IntRestore(p);
+   return pvPts[n];
 }
 
 // Get current calculated tidal volume
 float GetTV( void )
 {
-   return 123.45;
+   return tidalVol;
 }
 
 float GetPIP( void )
@@ -74,6 +163,27 @@ float GetFlowHistory( uint8_t ndx )
    return ret;
 }
 
+// Return the number of history samples taken so far.  This is the
+// sequence number of the newest sample.
+uint32_t GetHistSeq( void )
+{
+   return histSeq;
+}
+
+// Get historic data by sequence number.  Only the last HIST_LEN
+// samples are kept.  Since samples don't move once stored, the
+// caller can walk through them without worrying about new samples
+// arriving in between.
+float GetPresHistAt( uint32_t seq )
+{
+   return presHist[ seq & (HIST_LEN-1) ];
+}
+
+float GetFlowHistAt( uint32_t seq )
+{
+   return flowHist[ seq & (HIST_LEN-1) ];
+}
+
 float GetPresAvg( uint16_t ms )
 {
    int samp = (ms + MS_PER_HIST_SAMP/2) / MS_PER_HIST_SAMP;
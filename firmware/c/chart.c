@@ -0,0 +1,124 @@
+/* chart.c */
+
+// Strip chart widget.
+//
+// The graph screens used to fetch and plot every history point each
+// time the screen was drawn, although only one new point arrives every
+// 30ms.  A strip chart instead keeps the columns it has already drawn
+// in a ring, in the display's own page layout.  Each new sample is
+// drawn into the next column of the ring, and the ring is then copied
+// to the display with the oldest column at the left.  The copy is just
+// two block copies per page, which is the same as scrolling the graph
+// one column in the frame buffer.
+//
+// The SSD1306 can also scroll on its own, but it scrolls on its own
+// timing rather than when a sample arrives, and the display driver
+// only sends the changes it can see in the frame buffer.
+
+#include "chart.h"
+#include "display.h"
+#include "string.h"
+
+// local functions
+static void DrawSample( StripChart *chart, float val );
+
+// Set up a chart to show the samples read by get, scaled so min is at
+// the bottom and max at the top.  The chart starts at the first whole
+// page at or below row y and fills the rest of the screen.
+//
+// This is called each time the chart is shown.  If nothing has changed
+// the chart is left alone, so only samples that arrived since it was
+// last drawn need to be added.
+void ChartSetup( StripChart *chart, ChartGet get, float min, float max, int y, int fill )
+{
+   int page = (y+7) >> 3;
+   if( page > DISP_PAGES-1 )
+      page = DISP_PAGES-1;
+
+   if( (chart->get == get) && (chart->min == min) && (chart->max == max) &&
+       (chart->page == page) && (chart->fill == fill) )
+      return;
+
+   chart->get   = get;
+   chart->min   = min;
+   chart->max   = max;
+   chart->page  = page;
+   chart->fill  = fill;
+   chart->head  = 0;
+   chart->lastY = -1;
+   chart->seq   = 0;
+   memset( chart->ring, 0, sizeof(chart->ring) );
+}
+
+// Add any samples up to seq that haven't been drawn yet, then
+// copy the chart to the display buffer.
+void ChartDraw( StripChart *chart, uint32_t seq )
+{
+   if( !chart->get )
+      return;
+
+   // If the chart is more than a full width behind, just
+   // redraw it from the oldest sample that's still visible.
+   uint32_t n = seq - chart->seq;
+   if( n > DISP_COLS )
+   {
+      chart->lastY = -1;
+      chart->seq = seq - DISP_COLS;
+      n = DISP_COLS;
+   }
+
+   while( n-- )
+   {
+      chart->seq++;
+      DrawSample( chart, chart->get( chart->seq ) );
+   }
+
+   // The oldest column is the one after the head
+   int old = (chart->head + 1) & (DISP_COLS-1);
+   int w = DISP_COLS - old;
+   for( int p=chart->page; p<DISP_PAGES; p++ )
+   {
+      DrawBitmap( &chart->ring[p][old], 0, p*8, w, 8, DRAW_SET );
+      if( old )
+         DrawBitmap( &chart->ring[p][0], w, p*8, old, 8, DRAW_SET );
+   }
+}
+
+// Draw one sample into the next column of the ring.  The trace is
+// connected to the previous sample by a vertical span, or in fill mode
+// everything below the sample is set.
+static void DrawSample( StripChart *chart, float val )
+{
+   int c = chart->head = (chart->head + 1) & (DISP_COLS-1);
+   int top = chart->page * 8;
+   int h = DISP_ROWS - top;
+
+   float f = (val - chart->min) / (chart->max - chart->min);
+   if( f < 0 ) f = 0;
+   if( f > 1 ) f = 1;
+
+   int y = DISP_ROWS-1 - (int)(f * (h-1) + 0.5f);
+
+   int y1 = y, y2 = y;
+   if( chart->fill )
+      y2 = DISP_ROWS-1;
+   else if( chart->lastY >= 0 )
+   {
+      if( chart->lastY < y1 ) y1 = chart->lastY;
+      if( chart->lastY > y2 ) y2 = chart->lastY;
+   }
+   chart->lastY = y;
+
+   for( int p=chart->page; p<DISP_PAGES; p++ )
+   {
+      uint8_t mask = 0;
+      int r1 = p*8, r2 = p*8+7;
+      if( (y1 <= r2) && (y2 >= r1) )
+      {
+         mask = 0xFF;
+         if( y1 > r1 ) mask &= 0xFF << (y1-r1);
+         if( y2 < r2 ) mask &= 0xFF >> (r2-y2);
+      }
+      chart->ring[p][c] = mask;
+   }
+}
@@ -6,6 +6,7 @@
 #include "loop.h"
 #include "pressure.h"
 #include "uart.h"
+#include "usb.h"
 #include "utils.h"
 
 // global data
@@ -37,7 +38,7 @@ void CPU_Init( void )
    rcc->periphClkEna[0] = 0x00001101;  // Flash, DMA1, CRC
    rcc->periphClkEna[1] = 0x00002007;  // GPIO, ADC
    rcc->periphClkEna[4] = 0x15200001;  // Timer 2, I2C1, USB, CRS, Power
-   rcc->periphClkEna[6] = 0x00035800;  // UART1, Timers 1, 15, 16, SPI1
+   rcc->periphClkEna[6] = 0x00035801;  // UART1, Timers 1, 15, 16, SPI1, SYSCFG
 
    // Reset caches and set latency for 80MHz opperation
    FlashReg *flash = (FlashReg *)FLASH_BASE;
@@ -100,6 +101,15 @@ void DisableInterrupt( int id )
    nvic->clrEna[ id>>5 ] = 1<<(id&0x1F);
 }
 
+// Set an interrupt pending so its handler runs as soon as
+// its priority allows
+void PendInterrupt( int id )
+{
+   IntCtrl_Regs *nvic = (IntCtrl_Regs *)NVIC_BASE;
+   id -= 16;
+   nvic->setPend[ id>>5 ] = 1<<(id&0x1F);
+}
+
 void Reset( void )
 {
    // Reset 
@@ -190,8 +200,8 @@ void (* const vectors[])(void) =
    BadISR,                                 //  27 - 0x06C 
    BadISR,                                 //  28 - 0x070 
    BadISR,                                 //  29 - 0x074 
-   BadISR,                                 //  30 - 0x078 
-   BadISR,                                 //  31 - 0x07C 
+   UART_ISR,                               //  30 - 0x078 - DMA1 channel 4
+   UART_RxISR,                             //  31 - 0x07C - DMA1 channel 5
    DispISR,                                //  32 - 0x080 
    BadISR,                                 //  33 - 0x084 
    BadISR,                                 //  34 - 0x088 
@@ -213,7 +223,7 @@ void (* const vectors[])(void) =
    BadISR,                                 //  50 - 0x0C8 
    SPI1_ISR,                               //  51 - 0x0CC - SPI1
    BadISR,                                 //  52 - 0x0D0 
-   UART_ISR,                               //  53 - 0x0D4 
+   BadISR,                                 //  53 - 0x0D4 
    BadISR,                                 //  54 - 0x0D8 
    BadISR,                                 //  55 - 0x0DC 
    BadISR,                                 //  56 - 0x0E0 
@@ -224,6 +234,26 @@ void (* const vectors[])(void) =
    BadISR,                                 //  61 - 0x0F4 
    BadISR,                                 //  62 - 0x0F8 
    BadISR,                                 //  63 - 0x0FC 
+   BadISR,                                 //  64 - 0x100 
+   BadISR,                                 //  65 - 0x104 
+   BadISR,                                 //  66 - 0x108 
+   BadISR,                                 //  67 - 0x10C 
+   BadISR,                                 //  68 - 0x110 
+   BadISR,                                 //  69 - 0x114 
+   BadISR,                                 //  70 - 0x118 
+   BadISR,                                 //  71 - 0x11C 
+   BadISR,                                 //  72 - 0x120 
+   BadISR,                                 //  73 - 0x124 
+   BadISR,                                 //  74 - 0x128 
+   BadISR,                                 //  75 - 0x12C 
+   BadISR,                                 //  76 - 0x130 
+   BadISR,                                 //  77 - 0x134 
+   BadISR,                                 //  78 - 0x138 
+   BadISR,                                 //  79 - 0x13C 
+   BadISR,                                 //  80 - 0x140 
+   BadISR,                                 //  81 - 0x144 
+   BadISR,                                 //  82 - 0x148 
+   USB_ISR,                                //  83 - 0x14C - USB
 };
 
 
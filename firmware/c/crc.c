@@ -0,0 +1,53 @@
+/* crc.c */
+
+// CRC calculation using the processor's hardware CRC unit.
+//
+// The CRC unit is left in its reset configuration, which is the
+// standard CRC-32 polynomial (0x04C11DB7) with an initial value of
+// 0xFFFFFFFF, no bit reversal of the input or output and no final XOR.
+// This is sometimes called CRC-32/MPEG-2.
+//
+// The store module uses these for its record CRCs, and uses the unit
+// directly to check parameters saved in its old format, so these
+// functions should only be called from the background task.
+
+#include "cpu.h"
+#include "crc.h"
+
+// Calculate the CRC of a block of bytes.
+uint32_t CalcCRC32( const uint8_t *dat, int len )
+{
+   return UpdateCRC32( CRC32_INIT, dat, len );
+}
+
+// Continue a CRC calculation with another block of bytes.
+// crc is the value returned for the data before this block.
+uint32_t UpdateCRC32( uint32_t crc, const uint8_t *dat, int len )
+{
+   CRC_Regs *reg = (CRC_Regs *)CRC_BASE;
+
+   // Reset the CRC unit, which loads the starting value
+   // from the init register
+   reg->init = crc;
+   reg->ctrl = 1;
+
+   // A 32-bit write is processed most significant bit first, so
+   // packing four bytes big endian gives the same result as writing
+   // them one at a time, in a quarter of the writes.
+   while( len >= 4 )
+   {
+      reg->data = ((uint32_t)dat[0]<<24) | ((uint32_t)dat[1]<<16) | ((uint32_t)dat[2]<<8) | dat[3];
+      dat += 4;
+      len -= 4;
+   }
+
+   // Any remaining bytes are written using byte accesses
+   while( len-- > 0 )
+      *(BREG *)&reg->data = *dat++;
+
+   crc = reg->data;
+
+   // Other users of the unit expect the default starting value
+   reg->init = CRC32_INIT;
+   return crc;
+}
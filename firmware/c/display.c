@@ -6,58 +6,150 @@
 #include "font_freesans20.h"
 #include "font_freesans16.h"
 #include "font_freesans12.h"
+#include "font_bigdigits28.h"
 #include "loop.h"
 #include "sprintf.h"
 #include "string.h"
 #include "timer.h"
 #include "trace.h"
 #include "utils.h"
+#include "vars.h"
 
 // The display is 64 pixels by 128 pixels.
 // Rows are grouped into 8 'pages' of 8 rows each.
 // Each byte of RAM on the display has one pixel / row
 // Ex, the first byte contains the first pixel in each of the first 8 rows
 // The LSB is the top row
-#define NUM_COLS        128
-#define NUM_ROWS        64
-#define NUM_PAGES       (NUM_ROWS/8)
+#define NUM_COLS        DISP_COLS
+#define NUM_ROWS        DISP_ROWS
+#define NUM_PAGES       DISP_PAGES
 
 #define DISP_ADDR       0x3C
 
+// Set to run the i2c bus at 1MHz (fast mode plus) rather than 400kHz.
+// The SSD1306 data sheet only promises 400kHz, but most panels are
+// fine at 1MHz with strong enough pull-ups.
+#define I2C_FAST_PLUS   0
+
+// Most bytes the i2c module can send before it has to be reloaded
+#define I2C_MAX_NBYTES  255
+
+// Approximate cost in bytes of the commands, addresses and interrupts
+// needed to start a block of data.  Used to decide whether the changes
+// are sent as one block covering all of them or a block per page.
+#define BLOCK_OVERHEAD  12
+
 // States used for communicating with display
 #define STATE_IDLE           0
-#define STATE_SET_PAGE_ADDR  1     // Sending a page address
-#define STATE_WRITE_PAGE     2     // Writing a page of display memory
+#define STATE_SET_ADDR       1     // Sending the address range of a block
+#define STATE_WRITE_DATA     2     // Writing a block of display memory
 #define STATE_DOING_INIT     3     // Doing one time init at startup
 
 // local functions
 static int SetupDisplay( void );
-static void StartDmaWrite( const uint8_t *buff, uint8_t len );
-static int SetPageAddr( uint8_t page );
-static void SendPage( uint8_t page );
+static void StartDmaWrite( const uint8_t *buff, int len );
+static void SetBlockAddr( void );
+static void SendBlock( void );
+static void FindChanges( uint8_t frame[][NUM_COLS] );
+static void StartFrame( void );
+static void AddBlock( int p1, int p2, int c1, int c2 );
+static uint32_t I2C_Count( int len );
+static int NumGlyphs( int32_t val, int dec, int digits, uint8_t *glyphs );
+static int GetGlyph( const FontInfo *font, const FontChar *fc, uint8_t *glyph );
+
+// The display is run in horizontal addressing mode.  Each block of
+// changes is written by setting the column and page range it covers
+// and then sending all of its data in a single transfer.  The display
+// wraps to the next page at the end of the column range on its own.
+typedef struct
+{
+   uint8_t page[2];        // First and last page
+   uint8_t col[2];         // First and last column
+   uint16_t off;           // Offset of the data in txData
+   uint16_t len;           // Data length, including the leading 0x40
+} DispBlock;
+
+// Digit glyphs for DrawNumber, already shifted for one alignment
+// within a page.  The glyphs are stored as whole cells including
+// the blank space around the character, and the mask gives the rows
+// of each page that the cell covers.  Drawing a digit is then just
+// masking its cell into the display buffer a page at a time.
+#define NUM_GLYPHS      12         // Digits, minus sign and decimal point
+#define GLYPH_MINUS     10
+#define GLYPH_POINT     11
+#define GLYPH_BLANK     12         // Just clears the cell
+#define CACHE_BYTES     1200       // Enough for the big digit font
+#define CACHE_ENTRIES   2
+
+typedef struct
+{
+   uint8_t valid;
+   uint8_t font;
+   uint8_t shift;                          // Rows from the top of the first page
+   uint8_t pages;                          // Pages the cells cover
+   uint8_t width[ NUM_GLYPHS ];            // Cell widths
+   uint16_t off[ NUM_GLYPHS ];             // Offset of each cell in data
+   uint8_t mask[ NUM_PAGES ];              // Rows of each page inside the cell
+   uint8_t data[ CACHE_BYTES ];            // Cells, one page after another
+} DigitCache;
+
+static DigitCache *FindDigitCache( int shift );
+
+// Largest character that can be drawn
+#define MAX_GLYPH_COLS  40
 
 // local data
-static uint8_t dirtyPages;
-static uint8_t dmaPage;
+static uint8_t blockCt;
+static uint8_t dmaBlock;
+static uint8_t fullUpdate;
+static uint16_t i2cRemain;
+static volatile int8_t pendFrame = -1;
+static uint8_t backNdx;
+static uint32_t frameCt;
+static uint32_t dropCt;
+static VarInfo varFrameCt;
+static VarInfo varDropCt;
 static uint8_t crntFont;
+static uint8_t nextCache;
+static DigitCache digitCache[ CACHE_ENTRIES ];
 static volatile uint8_t dispState;
 static const FontInfo *fontList[] = 
 {
    &freesans20,
    &freesans16,
    &freesans12,
+   &bigdigits28,
 };
 
-// The display buffer is a local copy of the RAM stored in the display itself.
-// I write to this buffer then use DMA to send it (via i2c) to the display.
-// The reason that there is one extra byte in each page (NUM_COL+1, not NUM_COL)
-// is for convenience when doing the DMA transfer.  The display i2c interface
-// requires an extra byte (always 0x40) to be sent before the data to identify the
-// transfer as a data transfer as opposed to a command transfer.  Having that 
-// extra byte available in the display buffer makes life much easer when setting
-// up the DMA transfer.  When I write data to the buffer, I just offset the column
-// by 1 to account for this.
-static uint8_t dispBuff[ NUM_PAGES ][ NUM_COLS+1 ];
+// The display is double buffered.  Drawing is done in the back buffer
+// while the other one holds the last finished frame, which waits there
+// until the display is free to take it.  When UpdateDisplay is called
+// the two are swapped.  If the display still hadn't taken the previous
+// frame by then, that one is dropped.
+//
+// Once the interrupt starts sending a frame its changes are copied out
+// (see below), so the frame buffer isn't needed any more.
+static uint8_t frames[2][ NUM_PAGES ][ NUM_COLS ];
+static uint8_t (*dispBuff)[ NUM_COLS ] = frames[0];
+
+// Drawing normally goes to the back buffer, but can be pointed
+// at another buffer of the same size with SetDrawTarget.
+static uint8_t (*target)[ NUM_COLS ];
+
+// Copy of what the display RAM holds once the transfer in progress is
+// done.  Each update compares the display buffer to this and only sends
+// the columns that changed, so a typical screen where a few digits
+// change costs a small fraction of a full refresh.
+static uint8_t shadow[ NUM_PAGES ][ NUM_COLS ];
+
+// The blocks being sent and their data.  The display i2c interface
+// requires an extra byte (always 0x40) to be sent before the data to
+// identify the transfer as a data transfer as opposed to a command
+// transfer, so each block's data starts with that.  Since the data
+// sent comes from here, the display buffer can be drawn into while a
+// transfer is in progress.
+static DispBlock blocks[ NUM_PAGES ];
+static uint8_t txData[ NUM_PAGES*(NUM_COLS+1) ];
 
 // Called at startup
 void InitDisplay()
@@ -80,17 +172,25 @@ void InitDisplay()
 
    // Configure the absurdly complex timing register to
    // the example values for a 16MHz input clock and 400kHz 
-   // i2c clock
+   // or 1MHz i2c clock.  Fast mode plus also needs the stronger
+   // output drivers enabled on the i2c pins.
+#if I2C_FAST_PLUS
+   SysCfg_Regs *syscfg = (SysCfg_Regs *)SYSCFG_BASE;
+   syscfg->cfg1 |= 0x00100000;
+   i2c->timing  = 0x00200204;
+#else
    i2c->timing  = 0x10320309;
+#endif
 
-   // Enable i2c module
-   i2c->ctrl[0] = 0x00004021;
+   // Enable i2c module with interrupts on stop and reload
+   i2c->ctrl[0] = 0x00004061;
 
    // I'm using DMA1 channel 6 to transmit data through this i2c 
    // module.  Configure the channel selection register to assign
-   // this function to that DMA channel.
+   // this function to that DMA channel.  The UART uses other
+   // channels in the same register.
    DMA_Reg *dma = (DMA_Reg *)DMA1_BASE;
-   dma->chanSel = 0x00300000;
+   dma->chanSel = (dma->chanSel & ~0x00F00000) | 0x00300000;
 
    // Setup the DMA channel, but don't enable it yet
    //
@@ -101,15 +201,156 @@ void InitDisplay()
    dma->channel[5].pAddr = (uint32_t)&i2c->txData;
    EnableInterrupt( INT_VECT_I2C1, 3 );
 
+   VarInit( &varFrameCt, VARID_DISP_FRAMES,  "disp_frames",  VAR_TYPE_INT32, &frameCt, VAR_FLG_READONLY );
+   VarInit( &varDropCt,  VARID_DISP_DROPPED, "disp_dropped", VAR_TYPE_INT32, &dropCt,  VAR_FLG_READONLY );
+
    SetupDisplay();
 }
 
-// Start copying contents of local page buffer to the OLED display
-// This is done using DMA, so this returns immediately after starting
-// the copy.  The copy itself takes a bit over 20ms.
+// Called when a new frame has been drawn.  The frame is queued to be
+// sent to the OLED display and drawing moves to the other buffer.
+// Only the parts that changed are sent, using DMA.  A full screen takes
+// a bit over 20ms.  If the display is idle the interrupt is triggered
+// to start sending right away, otherwise it starts the frame once the
+// one before is done.
+//
+// The new back buffer starts out as a copy of the frame just queued,
+// so the next frame only needs to redraw the parts that change.
 void UpdateDisplay( void )
 {
-   dmaPage = SetPageAddr( 0 );
+   int done = backNdx;
+
+   int p = IntSuspend();
+   if( pendFrame >= 0 )
+      dropCt++;
+   pendFrame = done;
+   backNdx ^= 1;
+   dispBuff = frames[backNdx];
+   int idle = (dispState == STATE_IDLE);
+   IntRestore(p);
+
+   if( idle )
+      PendInterrupt( INT_VECT_I2C1 );
+
+   memcpy( dispBuff, frames[done], sizeof(frames[0]) );
+}
+
+// Returns true once the display has taken the last frame, so there's
+// no point in drawing the next one any sooner.
+int DisplayReady( void )
+{
+   return pendFrame < 0;
+}
+
+// Start sending the waiting frame, if there is one.
+// Called from the interrupt once the display is idle.
+static void StartFrame( void )
+{
+   while( pendFrame >= 0 )
+   {
+      int f = pendFrame;
+      pendFrame = -1;
+
+      FindChanges( frames[f] );
+      if( blockCt )
+      {
+         dmaBlock = 0;
+         SetBlockAddr();
+         return;
+      }
+
+      // Nothing changed, so this frame is already done
+      frameCt++;
+   }
+}
+
+// Compare the display buffer to the shadow copy of the display RAM and
+// find the range of columns that changed in each page.  The changes are
+// sent either as one block covering all of them or a block per page,
+// whichever is less data.  The changed columns are copied into the
+// shadow buffer and then packed into the transmit buffer.
+static void FindChanges( uint8_t frame[][NUM_COLS] )
+{
+   uint8_t lo[ NUM_PAGES ], hi[ NUM_PAGES ];
+   int first = -1, last = 0;
+   int minCol = NUM_COLS, maxCol = 0;
+   int pageCost = 0;
+
+   for( int p=0; p<NUM_PAGES; p++ )
+   {
+      const uint8_t *buf = frame[p];
+      uint8_t *shd = shadow[p];
+
+      int c1 = 0;
+      int c2 = NUM_COLS-1;
+      if( !fullUpdate )
+      {
+         while( (c1 < NUM_COLS) && (buf[c1] == shd[c1]) ) c1++;
+         if( c1 == NUM_COLS )
+         {
+            lo[p] = 1;
+            hi[p] = 0;
+            continue;
+         }
+         while( buf[c2] == shd[c2] ) c2--;
+      }
+
+      memcpy( &shd[c1], &buf[c1], c2-c1+1 );
+      lo[p] = c1;
+      hi[p] = c2;
+
+      if( first < 0 ) first = p;
+      last = p;
+      if( c1 < minCol ) minCol = c1;
+      if( c2 > maxCol ) maxCol = c2;
+      pageCost += c2-c1+1 + BLOCK_OVERHEAD;
+   }
+   fullUpdate = 0;
+
+   blockCt = 0;
+   if( first < 0 )
+      return;
+
+   int oneCost = (last-first+1) * (maxCol-minCol+1) + BLOCK_OVERHEAD;
+   if( oneCost <= pageCost )
+   {
+      AddBlock( first, last, minCol, maxCol );
+      return;
+   }
+
+   for( int p=first; p<=last; p++ )
+   {
+      if( lo[p] <= hi[p] )
+         AddBlock( p, p, lo[p], hi[p] );
+   }
+}
+
+// Add a block of the display to the list to be sent,
+// and copy its data from the shadow buffer.
+static void AddBlock( int p1, int p2, int c1, int c2 )
+{
+   int off = 0;
+   if( blockCt )
+   {
+      DispBlock *prev = &blocks[blockCt-1];
+      off = prev->off + prev->len;
+   }
+
+   DispBlock *b = &blocks[blockCt++];
+   b->page[0] = p1;
+   b->page[1] = p2;
+   b->col[0]  = c1;
+   b->col[1]  = c2;
+   b->off     = off;
+
+   uint8_t *ptr = &txData[off];
+   *ptr++ = 0x40;
+
+   int w = c2-c1+1;
+   for( int p=p1; p<=p2; p++, ptr += w )
+      memcpy( ptr, &shadow[p][c1], w );
+
+   b->len = ptr - &txData[off];
 }
 
 int SetFont( uint8_t id )
@@ -134,11 +375,25 @@ const FontInfo *CrntFont( void )
    return GetFontInfo( crntFont );
 }
 
+// Return the buffer being drawn into
+static inline uint8_t (*DrawBuff( void ))[ NUM_COLS ]
+{
+   return target ? target : dispBuff;
+}
+
+// Select a buffer for the drawing functions to draw into instead
+// of the display.  This lets screens keep parts that only change a
+// little at a time and copy them into each frame with DrawBitmap.
+// Pass 0 to go back to drawing on the display.
+void SetDrawTarget( uint8_t buff[][DISP_COLS] )
+{
+   target = buff;
+}
+
 // Clear the entire display
 void ClearDisplay( void )
 {
-   memset( dispBuff, 0, sizeof(dispBuff));
-   dirtyPages = 0xFF;
+   memset( DrawBuff(), 0, sizeof(frames[0]) );
 }
 
 // Set a pixel without checking bounds
@@ -151,9 +406,7 @@ static inline void SetPixel_NoCheck( int x, int y )
    // Find the right column in the page
    uint8_t mask = 1 << (y&7);
 
-   // Note that there's an extra column at the start of 
-   // display memory.
-   dispBuff[p][x+1] |= mask;
+   DrawBuff()[p][x] |= mask;
 }
 
 // Clear a pixel without checking bounds
@@ -166,9 +419,7 @@ static inline void ClearPixel_NoCheck( int x, int y )
    // Find the right column in the page
    uint8_t mask = 1 << (y&7);
 
-   // Note that there's an extra column at the start of 
-   // display memory.
-   dispBuff[p][x+1] &= ~mask;
+   DrawBuff()[p][x] &= ~mask;
 }
 
 void SetPixel( int x, int y )
@@ -185,11 +436,52 @@ void ClearPixel( int x, int y )
    ClearPixel_NoCheck( x, y );
 }
 
+// Apply a drawing operation to the pixels in a mask
+static inline uint8_t PixelOp( uint8_t val, uint8_t mask, int op )
+{
+   switch( op )
+   {
+      case DRAW_CLEAR:  return val & ~mask;
+      case DRAW_INVERT: return val ^ mask;
+      default:          return val | mask;
+   }
+}
+
+// Apply a drawing operation to a rectangle given by its
+// corners.  The rectangle must already be clipped.
+// Each page the rectangle touches is handled a column at a time with
+// a mask covering the rows in that page, so this is 8 times faster
+// than going pixel by pixel for tall areas.
+static void RectOp( int x1, int y1, int x2, int y2, int op )
+{
+   int p1 = y1>>3;
+   int p2 = y2>>3;
+   int w = x2-x1+1;
+
+   for( int p=p1; p<=p2; p++ )
+   {
+      uint8_t mask = 0xFF;
+      if( p == p1 ) mask &= 0xFF << (y1&7);
+      if( p == p2 ) mask &= 0xFF >> (7-(y2&7));
+
+      uint8_t *ptr = &DrawBuff()[p][x1];
+
+      if( (mask == 0xFF) && (op != DRAW_INVERT) )
+      {
+         memset( ptr, (op == DRAW_CLEAR) ? 0 : 0xFF, w );
+         continue;
+      }
+
+      for( int i=0; i<w; i++ )
+         ptr[i] = PixelOp( ptr[i], mask, op );
+   }
+}
+
 // Fill an are of the screen.
 // x,y   top left pixel to fill
 // w,h   width and height of rectangle
-// color 0 for black.  non-zero for white
-void FillRect( int x1, int y1, int w, int h, int color )
+// op    DRAW_CLEAR, DRAW_SET or DRAW_INVERT
+void FillRect( int x1, int y1, int w, int h, int op )
 {
    if( (w < 1) || (h < 1) ) return;
    if( x1 >= NUM_COLS ) return;
@@ -204,20 +496,129 @@ void FillRect( int x1, int y1, int w, int h, int color )
    if( x2 >= NUM_COLS ) x2 = NUM_COLS-1;
    if( y2 >= NUM_ROWS ) y2 = NUM_ROWS-1;
 
-   // TODO:
-   // I set/clear pixels one at a time.
-   // This could be more efficient
-   if( color )
+   RectOp( x1, y1, x2, y2, op );
+}
+
+// Draw a horizontal line w pixels long starting at x,y
+void HLine( int x, int y, int w, int op )
+{
+   FillRect( x, y, w, 1, op );
+}
+
+// Draw a vertical line h pixels long starting at x,y
+void VLine( int x, int y, int h, int op )
+{
+   FillRect( x, y, 1, h, op );
+}
+
+// Draw a line between two points using Bresenham's algorithm.
+// Rather than plotting one pixel at a time, the line is drawn as a
+// series of horizontal or vertical runs.  For steep lines the runs
+// are vertical and cover up to 8 pixels per byte written.
+void DrawLine( int x1, int y1, int x2, int y2, int op )
+{
+   int dx = x2-x1;
+   int dy = y2-y1;
+   if( dx < 0 ) dx = -dx;
+   if( dy < 0 ) dy = -dy;
+
+   if( dx >= dy )
    {
+      // Mostly horizontal.  Always draw left to right
+      if( x1 > x2 )
+      {
+         int t;
+         t = x1; x1 = x2; x2 = t;
+         t = y1; y1 = y2; y2 = t;
+      }
+
+      int sy = (y2 > y1) ? 1 : -1;
+      int err = dx/2;
+      int start = x1;
       for( int x=x1; x<=x2; x++ )
-         for( int y=y1; y<=y2; y++ )
-            SetPixel_NoCheck( x, y );
+      {
+         err -= dy;
+         if( (err < 0) || (x == x2) )
+         {
+            HLine( start, y1, x-start+1, op );
+            start = x+1;
+            y1 += sy;
+            err += dx;
+         }
+      }
    }
    else
    {
-      for( int x=x1; x<=x2; x++ )
-         for( int y=y1; y<=y2; y++ )
-            ClearPixel_NoCheck( x, y );
+      // Mostly vertical.  Always draw top to bottom
+      if( y1 > y2 )
+      {
+         int t;
+         t = x1; x1 = x2; x2 = t;
+         t = y1; y1 = y2; y2 = t;
+      }
+
+      int sx = (x2 > x1) ? 1 : -1;
+      int err = dy/2;
+      int start = y1;
+      for( int y=y1; y<=y2; y++ )
+      {
+         err -= dx;
+         if( (err < 0) || (y == y2) )
+         {
+            VLine( x1, start, y-start+1, op );
+            start = y+1;
+            x1 += sx;
+            err += dy;
+         }
+      }
+   }
+}
+
+// Draw a 1 bit per pixel bitmap with its top left corner at x,y.
+// The bitmap uses the same layout as the display: (h+7)/8 pages of
+// w bytes each, with the LSB of each byte being the top row.  Parts
+// that fall off the screen are clipped.
+//
+// With DRAW_SET the bitmap's set pixels are turned on, with DRAW_CLEAR
+// they're turned off and with DRAW_INVERT they're toggled.  Pixels that
+// are clear in the bitmap are left alone.
+void DrawBitmap( const uint8_t *bm, int x, int y, int w, int h, int op )
+{
+   if( (w < 1) || (h < 1) ) return;
+   if( (x >= NUM_COLS) || (y >= NUM_ROWS) ) return;
+   if( (x+w <= 0) || (y+h <= 0) ) return;
+
+   int srcPages = (h+7)/8;
+
+   // Clip columns
+   int c1 = (x < 0) ? -x : 0;
+   int c2 = (x+w > NUM_COLS) ? NUM_COLS-x : w;
+
+   // Each source page lands in up to two display pages, shifted
+   // down by the offset of y within its page.  Rows outside the
+   // bitmap's height or the screen are masked off.
+   int shift = y & 7;
+   uint8_t *base = DrawBuff()[0];
+   for( int sp=0; sp<srcPages; sp++ )
+   {
+      uint8_t srcMask = 0xFF;
+      if( sp == srcPages-1 )
+         srcMask = 0xFF >> (srcPages*8 - h);
+
+      int dp = (y >> 3) + sp;            // Display page for the top part
+
+      const uint8_t *src = &bm[ sp*w ];
+      for( int c=c1; c<c2; c++ )
+      {
+         uint16_t v = (uint16_t)(src[c] & srcMask) << shift;
+         uint8_t *col = &base[x+c];
+
+         if( (dp >= 0) && (dp < NUM_PAGES) )
+            col[dp*NUM_COLS] = PixelOp( col[dp*NUM_COLS], v, op );
+
+         if( (dp+1 >= 0) && (dp+1 < NUM_PAGES) && (v>>8) )
+            col[(dp+1)*NUM_COLS] = PixelOp( col[(dp+1)*NUM_COLS], v>>8, op );
+      }
    }
 }
 
@@ -264,71 +665,346 @@ int DrawChar( uint8_t ch, int x, int y )
    // to draw the character.  
    x += fc->xOff;
 
-   // Add one more to the column to account for the extra byte at the start of
-   // each row in my display buffer.  The extra byte is to make DMA transfers
-   // easer to set up.
-   x += 1;
-
-   // The actual pixel data that describes the character is stored 
-   // in the bitmap array.  The bmOff field of the character gives
-   // the offset into the fonts bitmap array.
-   const uint8_t *bitmap = &font->bitmap[ fc->bmOff ];
-
-   // Each byte of the bitmap represents up to 8 rows of a single column
-   // of the font.  This allows us to quickly copy the bitmap data into
-   // my display memory which is formatted similarly.
-   // I can figure out how many bytes / column by dividing the font's
-   // yAdv (i.e. total height of all characters) by 8 and rounding up.
-   // Find bytes / column
-   int bpc = (font->yAdv+7)/8;
-
-   // Find how many columns we're writing
-   int cols = fc->bmLen / bpc;
+   // Get the character's bitmap, one page after another
+   uint8_t glyph[ NUM_PAGES * MAX_GLYPH_COLS ];
+   int cols = GetGlyph( font, fc, glyph );
 
    // Find the first page (group of 8 rows) that I'll
    // be writing to.  That's basically the upper bits of the y
-   // value.
+   // value.  If the character isn't aligned with a page then
+   // each byte is split between two pages.
    int p1 = y>>3;
+   int shift = y&7;
+   int bpc = (font->yAdv+7)/8;
+
+   uint8_t (*buff)[ NUM_COLS ] = DrawBuff();
+
+   const uint8_t *src = glyph;
+   for( int p=0; p<bpc; p++, src += cols )
+   {
+      uint8_t *dst = &buff[p1+p][x];
+      for( int c=0; c<cols; c++ )
+         dst[c] |= src[c] << shift;
+
+      if( !shift || (p1+p+1 >= NUM_PAGES) )
+         continue;
 
-   // Find the number of pages I need to write to.
-   // That's the number of bytes/col if we're evenly
-   // aligned with a page, or bpc+1 if not since the first 
-   // and last page will get part of the font.
-   int pgCt = (y&7) ? bpc+1 : bpc;
+      dst = &buff[p1+p+1][x];
+      for( int c=0; c<cols; c++ )
+         dst[c] |= src[c] >> (8-shift);
+   }
 
-   for( int p=0, mask=(1<<p1); p<pgCt; p++, mask<<=1 )
-      dirtyPages |= mask;
+   // I return the x advance value for this character
+   return fc->xAdv;
+}
+
+// Get the bitmap of a character, page by page with the top page
+// first.  Each byte holds 8 rows of one column, with the top row
+// in the low bit like the display.  Returns the number of columns.
+//
+// Fonts are either stored as plain bitmaps, column by column with
+// the top page last, or compressed (see util/makefont.py).  The
+// compressed bitmaps start with the number of columns, followed by
+// runs each starting with a control byte:
+//
+//   00nnnnnn - n+1 literal bytes follow
+//   01nnnnnn - n+1 bytes of 0x00
+//   10nnnnnn - n+1 bytes of 0xFF
+//   11nnnnnn - n+1 copies of the byte that follows
+static int GetGlyph( const FontInfo *font, const FontChar *fc, uint8_t *glyph )
+{
+   const uint8_t *bm = &font->bitmap[ fc->bmOff ];
+   int bpc = (font->yAdv+7)/8;
 
-   // Update all the columns that this font touches
-   for( int c=0; c<cols; c++ )
+   if( !(font->flags & FONT_FLG_RLE) )
    {
-      // Combine all the bytes for this column into a single
-      // large integer.  I'm currently using a 32-bit integer which 
-      // restricts the max font height to 25 bits.  I could change 
-      // the type to uint64_t if I ever wanted to support larger fonts, 
-      // but 25 bits is plenty for this display which only has 64 rows.
-      uint32_t C = 0;
-      for( int p=0; p<bpc; p++ )
+      int cols = fc->bmLen / bpc;
+      if( cols > MAX_GLYPH_COLS )
+         return 0;
+
+      for( int c=0; c<cols; c++ )
       {
-         C <<= 8;
-         C |= *bitmap++;
+         for( int p=bpc-1; p>=0; p-- )
+            glyph[ p*cols + c ] = *bm++;
       }
+      return cols;
+   }
 
-      // Shift the column lefd (down) based on the lower 3 bits of 
-      // my y value.  That ensures that I write to the correct
-      // location in the buffer.
-      C <<= (y&7);
+   const uint8_t *end = bm + fc->bmLen;
+   int cols = *bm++;
+   if( cols > MAX_GLYPH_COLS )
+      return 0;
+
+   uint8_t *out = glyph;
+   uint8_t *outEnd = glyph + cols*bpc;
+   while( (bm < end) && (out < outEnd) )
+   {
+      int ctrl = *bm++;
+      int n = (ctrl & 0x3F) + 1;
+      if( n > outEnd-out )
+         n = outEnd-out;
 
-      // Update all the pages of display memory that the font touches
-      for( int p=0; p<pgCt; p++ )
+      switch( ctrl >> 6 )
       {
-         dispBuff[p1+p][c+x] |= C;
-         C >>= 8;
+         case 0:
+            // Don't read past the end of a bitmap that's cut short
+            if( n > end-bm )
+               n = end-bm;
+            memcpy( out, bm, n );
+            bm += (ctrl & 0x3F) + 1;
+            break;
+
+         case 1:
+            memset( out, 0x00, n );
+            break;
+
+         case 2:
+            memset( out, 0xFF, n );
+            break;
+
+         case 3:
+            if( bm == end )
+               n = 0;
+            else
+               memset( out, *bm++, n );
+            break;
       }
+      out += n;
    }
 
-   // I return the x advance value for this character
-   return fc->xAdv;
+   // Anything missing from a bad bitmap is left blank
+   if( out < outEnd )
+      memset( out, 0, outEnd-out );
+
+   return cols;
+}
+
+// Draw a number using the current font.  The value is a fixed point
+// number with dec digits after the decimal point, and is drawn right
+// justified in a field of digits characters plus the point.  The field
+// always has the same width, and unused characters are cleared, so a
+// number can be drawn over the last one without clearing first.
+// Values that don't fit are shown as dashes.
+//
+// This is faster than formatting the number and drawing it as a
+// string, since the digit glyphs come pre-shifted from a cache.
+// Returns the width of the field, or 0 if it won't fit on the display,
+// the font is too large for the cache or the field has no room for a
+// digit in front of the point.
+int DrawNumber( int32_t val, int dec, int digits, int x, int y )
+{
+   // There has to be at least one digit in front of the point
+   uint8_t glyphs[ 12 ];
+   if( (dec < 0) || (digits < dec+1) )
+      return 0;
+
+   if( (dec ? digits+1 : digits) > (int)sizeof(glyphs) )
+      return 0;
+
+   const FontInfo *font = CrntFont();
+   if( !font || (y<0) || (y >= (NUM_ROWS-font->yAdv)) )
+      return 0;
+
+   DigitCache *dc = FindDigitCache( y&7 );
+   if( !dc )
+      return 0;
+
+   int ct = NumGlyphs( val, dec, digits, glyphs );
+
+   // Find the total width first so nothing is drawn if it won't fit
+   int digW = dc->width[0];
+   int w = 0;
+   for( int i=0; i<ct; i++ )
+      w += (glyphs[i] == GLYPH_BLANK) ? digW : dc->width[ glyphs[i] ];
+
+   if( (x<0) || (x+w > NUM_COLS) )
+      return 0;
+
+   uint8_t (*buff)[ NUM_COLS ] = DrawBuff();
+   int p1 = y>>3;
+
+   for( int i=0; i<ct; i++ )
+   {
+      int g = glyphs[i];
+      int cw = (g == GLYPH_BLANK) ? digW : dc->width[g];
+
+      for( int p=0; p<dc->pages; p++ )
+      {
+         uint8_t *dst = &buff[p1+p][x];
+         uint8_t m = dc->mask[p];
+
+         if( g == GLYPH_BLANK )
+         {
+            for( int c=0; c<cw; c++ )
+               dst[c] &= ~m;
+         }
+         else if( m == 0xFF )
+            memcpy( dst, &dc->data[ dc->off[g] + p*cw ], cw );
+         else
+         {
+            const uint8_t *src = &dc->data[ dc->off[g] + p*cw ];
+            for( int c=0; c<cw; c++ )
+               dst[c] = (dst[c] & ~m) | src[c];
+         }
+      }
+      x += cw;
+   }
+
+   return w;
+}
+
+// Convert a fixed point value to a list of glyphs, right justified in
+// a field of digits characters.  A decimal point is added if dec isn't
+// zero, and there's always at least one digit in front of it.
+// Returns the number of glyphs.
+static int NumGlyphs( int32_t val, int dec, int digits, uint8_t *glyphs )
+{
+   int ct = dec ? digits+1 : digits;
+   int neg = (val < 0);
+   uint32_t u = neg ? -(uint32_t)val : (uint32_t)val;
+
+   // Digits are added from the right until the value runs out.  All
+   // the digits after the point and the one in front of it are shown
+   // even if they're zero.
+   int need = dec ? dec+2 : 1;
+   int i = ct;
+   int n = 0;
+   while( i > 0 )
+   {
+      if( dec && (n == dec) )
+         glyphs[--i] = GLYPH_POINT;
+      else if( u || (n < need) )
+      {
+         glyphs[--i] = u % 10;
+         u /= 10;
+      }
+      else
+         break;
+      n++;
+   }
+
+   // Add the sign, and show dashes if there wasn't room
+   if( neg )
+   {
+      if( i > 0 )
+         glyphs[--i] = GLYPH_MINUS;
+      else
+         u = 1;
+   }
+
+   if( u )
+   {
+      for( i=0; i<ct; i++ )
+         glyphs[i] = (dec && (i == ct-dec-1)) ? GLYPH_POINT : GLYPH_MINUS;
+      return ct;
+   }
+
+   while( i > 0 )
+      glyphs[--i] = GLYPH_BLANK;
+
+   return ct;
+}
+
+// Find the digit cache entry for the current font with its glyphs
+// shifted down by shift rows.  If there isn't one the oldest entry is
+// filled in.  Returns 0 if the font is too large for the cache.
+static DigitCache *FindDigitCache( int shift )
+{
+   const FontInfo *font = CrntFont();
+
+   for( int i=0; i<CACHE_ENTRIES; i++ )
+   {
+      DigitCache *dc = &digitCache[i];
+      if( dc->valid && (dc->font == crntFont) && (dc->shift == shift) )
+         return dc;
+   }
+
+   int bpc = (font->yAdv+7)/8;
+   int pages = (shift + font->yAdv + 7) / 8;
+   if( pages > NUM_PAGES )
+      return 0;
+
+   DigitCache *dc = &digitCache[ nextCache ];
+   memset( dc, 0, sizeof(*dc) );
+
+   // Find the cell widths.  All the digits and the minus sign get the
+   // width of the widest digit, so the field width doesn't depend on
+   // the value.
+   static const char glyphChars[ NUM_GLYPHS ] = "0123456789-.";
+   const FontChar *fcs[ NUM_GLYPHS ];
+   int digW = 0;
+   for( int g=0; g<NUM_GLYPHS; g++ )
+   {
+      int ch = glyphChars[g];
+      fcs[g] = 0;
+      if( (ch < font->firstChar) || (ch > font->lastChar) )
+         continue;
+
+      fcs[g] = &font->chars[ ch - font->firstChar ];
+      dc->width[g] = fcs[g]->xAdv;
+      if( (g < 10) && (dc->width[g] > digW) )
+         digW = dc->width[g];
+   }
+
+   int tot = 0;
+   for( int g=0; g<NUM_GLYPHS; g++ )
+   {
+      if( g <= GLYPH_MINUS )
+         dc->width[g] = digW;
+      dc->off[g] = tot;
+      tot += dc->width[g] * pages;
+   }
+
+   if( tot > CACHE_BYTES )
+      return 0;
+
+   // Draw each glyph into its cell
+   for( int g=0; g<NUM_GLYPHS; g++ )
+   {
+      if( !fcs[g] )
+         continue;
+
+      uint8_t glyph[ NUM_PAGES * MAX_GLYPH_COLS ];
+      int cols = GetGlyph( font, fcs[g], glyph );
+      int w = dc->width[g];
+      int x = fcs[g]->xOff;
+      if( x + cols > w )
+         return 0;
+
+      uint8_t *cell = &dc->data[ dc->off[g] ];
+      const uint8_t *src = glyph;
+      for( int p=0; p<bpc; p++, src += cols )
+      {
+         uint8_t *dst = &cell[ p*w + x ];
+         for( int c=0; c<cols; c++ )
+            dst[c] |= src[c] << shift;
+
+         if( !shift || (p+1 >= pages) )
+            continue;
+
+         dst += w;
+         for( int c=0; c<cols; c++ )
+            dst[c] |= src[c] >> (8-shift);
+      }
+   }
+
+   // Find which rows of each page are inside the cell
+   int r1 = shift;
+   int r2 = shift + font->yAdv - 1;
+   for( int p=0; p<pages; p++ )
+   {
+      uint8_t m = 0xFF;
+      if( r1 > p*8 )   m &= 0xFF << (r1 - p*8);
+      if( r2 < p*8+7 ) m &= 0xFF >> (p*8+7 - r2);
+      dc->mask[p] = m;
+   }
+
+   nextCache = (nextCache+1) % CACHE_ENTRIES;
+   dc->font  = crntFont;
+   dc->shift = shift;
+   dc->pages = pages;
+   dc->valid = 1;
+   return dc;
 }
 
 static int SetupDisplay( void )
@@ -338,7 +1014,7 @@ static int SetupDisplay( void )
    {
       0x00,            // All command strings start with 0
       0xAE,            // Turn the display off
-      0x20, 0x02,      // Set memory addressing to page mode
+      0x20, 0x00,      // Set memory addressing to horizontal mode
       0x40,            // Make sure RAM starts at the first row
       0xA6,            // Set normal (not inverted) display
       0xA0,            // Reverse the display left/right
@@ -356,14 +1032,21 @@ static int SetupDisplay( void )
 
    // TODO - I should really add some error handling.
    //        not sure exactly what to do though.
-   dirtyPages = 0xff;
-   dmaPage = SetPageAddr( 0 );
+
+   // The display RAM holds random data at power up, so
+   // the first update sends everything.
+   fullUpdate = 1;
+   dispState = STATE_IDLE;
+   UpdateDisplay();
 
    return 0;
 }
 
 // Start writing to the display using DMA
-static void StartDmaWrite( const uint8_t *buff, uint8_t len )
+// The i2c module can only count 255 bytes at a time, so longer writes
+// are split up by reloading the count from the interrupt.  The DMA
+// transfer runs straight through.
+static void StartDmaWrite( const uint8_t *buff, int len )
 {
    DMA_Reg *dma = (DMA_Reg *)DMA1_BASE;
    I2C_Regs *i2c = (I2C_Regs *)I2C1_BASE;
@@ -377,55 +1060,50 @@ static void StartDmaWrite( const uint8_t *buff, uint8_t len )
 
    // Configure the i2c module and send the address
    i2c->intClr  = 0x00003F38;
-   i2c->ctrl[1] = (DISP_ADDR<<1) | 0x02002000 | (len<<16);
+   i2c->ctrl[1] = (DISP_ADDR<<1) | 0x00002000 | I2C_Count( len );
 }
 
-// Sets the address at which data will be written in the display
-static int SetPageAddr( uint8_t page )
+// Find the bits of the i2c control register that set the number
+// of bytes to send next, and how it ends.
+static uint32_t I2C_Count( int len )
 {
-   // Find the first dirty page starting with the value passed in
-   // and if one is found, begin a write to it.
-   // Returns the page number being written, or -1 if there
-   // isn't one found
-   while( page < 8 )
+   if( len > I2C_MAX_NBYTES )
    {
-      if( dirtyPages & (1<<page) )
-         break;
-      page++;
+      i2cRemain = len - I2C_MAX_NBYTES;
+      return 0x01000000 | (I2C_MAX_NBYTES<<16);
    }
 
-   if( page >= 8 )
-      return -1;
-
-   dirtyPages &= ~(1<<page);
+   i2cRemain = 0;
+   return 0x02000000 | (len<<16);
+}
 
-   uint8_t col = 0;
+// Sets the range of columns and pages that the next block
+// will be written to.
+static void SetBlockAddr( void )
+{
+   DispBlock *b = &blocks[dmaBlock];
 
-   static uint8_t setAddrCmdBuff[4];
+   static uint8_t setAddrCmdBuff[7];
    setAddrCmdBuff[0] = 0x00;              // All commands start with zero
-   setAddrCmdBuff[1] = 0xB0 | (page&7);   // Set page start address
-   setAddrCmdBuff[2] = 0x00 | (col&0x0F); // Set lower column address
-   setAddrCmdBuff[3] = 0x10 | (col>>4);   // Set upper column address
-
-   dispState = STATE_SET_PAGE_ADDR;
+   setAddrCmdBuff[1] = 0x21;              // Set column range
+   setAddrCmdBuff[2] = b->col[0];
+   setAddrCmdBuff[3] = b->col[1];
+   setAddrCmdBuff[4] = 0x22;              // Set page range
+   setAddrCmdBuff[5] = b->page[0];
+   setAddrCmdBuff[6] = b->page[1];
+
+   dispState = STATE_SET_ADDR;
 GPIO_SetPin( DIGIO_A_BASE, 7 );
    StartDmaWrite( setAddrCmdBuff, sizeof(setAddrCmdBuff) );
-   return page;
 }
 
-static void SendPage( uint8_t page )
+static void SendBlock( void )
 {
-   page &= 7;
-
-   // The first byte that we send is always 0x40
-   // which tells the display that this is data, 
-   // not a command.  There's an extra column
-   // in the display buffer for this purpose
-   dispBuff[page][0] = 0x40;
+   DispBlock *b = &blocks[dmaBlock];
 
-   dispState = STATE_WRITE_PAGE;
+   dispState = STATE_WRITE_DATA;
 GPIO_ClrPin( DIGIO_A_BASE, 7 );
-   StartDmaWrite(dispBuff[page], NUM_COLS+1 );
+   StartDmaWrite( &txData[b->off], b->len );
 }
 
 void DispISR( void )
@@ -433,30 +1111,42 @@ void DispISR( void )
    // Clear the interrupt
    I2C_Regs *i2c = (I2C_Regs *)I2C1_BASE;
 
+   // The i2c module has sent all the bytes it was told to
+   // and more are waiting.  Reload the count.
+   if( i2c->status & 0x0080 )
+   {
+      i2c->ctrl[1] = (DISP_ADDR<<1) | I2C_Count( i2cRemain );
+      return;
+   }
+
    i2c->intClr  = 0x00003F38;
 
    switch( dispState )
    {
-      // We just finished sending a page address.
-      // Now we should send that page's data
-      case STATE_SET_PAGE_ADDR:
-         SendPage( dmaPage );
+      // We just finished sending a block's address range.
+      // Now we should send its data
+      case STATE_SET_ADDR:
+         SendBlock();
          return;
 
-      // We just finished sending a page of data
-      // Start writing the next dirty page
-      case STATE_WRITE_PAGE:
-      {
-         int p = SetPageAddr( dmaPage );
-         if( p < 0 )
-            dispState = STATE_IDLE;
-         dmaPage = p;
-         return;
-      }
+      // We just finished sending a block of data
+      // Start writing the next one
+      case STATE_WRITE_DATA:
+         if( ++dmaBlock < blockCt )
+         {
+            SetBlockAddr();
+            return;
+         }
+         frameCt++;
+         break;
 
+      // We also get here when UpdateDisplay triggers
+      // the interrupt to start a frame
       default:
-         dispState = STATE_IDLE;
-         return;
+         break;
    }
+
+   dispState = STATE_IDLE;
+   StartFrame();
 }
 
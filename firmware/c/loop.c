@@ -47,6 +47,7 @@ void LoopInit( void )
 
    loopFreq = LOOP_FREQ;
    VarInit( &varLoopFreq, VARID_LOOP_FREQ, "loop_freq", VAR_TYPE_INT16, &loopFreq, VAR_FLG_READONLY );
+   varLoopFreq.units = "Hz";
 }
 
 void LoopStart( void )
@@ -11,7 +11,6 @@
 #include "loop.h"
 #include "pressure.h"
 #include "sercmd.h"
-#include "sprintf.h"
 #include "store.h"
 #include "timer.h"
 #include "trace.h"
@@ -32,7 +31,8 @@ int main( void )
    for( int i=0; i<32; i++ )
       dbgLong[i] = 0;
 
-   SerCmdInfo cmd[2];
+   // The command buffers are too large for the main stack
+   static SerCmdInfo cmd[3];
 
    // Init the processor and various modules
    CPU_Init();
@@ -56,33 +56,26 @@ int main( void )
    InitUSB();
    InitAutoOffset();
    InitSerCmd( &cmd[0], 0 );
-//   InitSerCmd( &cmd[1], 1 );
+   InitSerCmd( &cmd[1], 1+USB_PORT_CDC );
+   InitSerCmd( &cmd[2], 1+USB_PORT_BULK );
 
    LoopStart();
 
    // The main loop handles lower priority background tasks
    // The higher priority work is done in interrupt handlers.
-uint16_t lastSend = TimerGetUsec();
    while( 1 )
    {
+      // Commands are accepted on the UART and both USB ports.  Each
+      // call handles at most one command, so polling the channels in
+      // turn keeps a busy one from starving the others.
       PollSerCmd( &cmd[0] );
-//      PollSerCmd( &cmd[1] );
+      PollSerCmd( &cmd[1] );
+      PollSerCmd( &cmd[2] );
       BuzzerPoll();
       PollIO();
       PollUserInterface();
       BkgPollPressure();
-      PollUSB();
-
-      // This is a temporary hack to stream data out the USB serial port
-      // when it's open.
-if( UsecSince( lastSend ) > 10000 )
-{
-   lastSend = TimerGetUsec();
-      char buff[80];
-      int len = sprintf( buff, "SLM: %5.3f\tPRS: % %5.2f\n", F2I(GetFlowRate()), F2I(GetPressure1()*PRESSURE_CM_H2O) );
-      if( USB_TxFree() >= len )
-         USB_Send( (uint8_t*)buff, len );
-}
+      PollUART();
    }
 }
 
@@ -3,8 +3,6 @@
 #include <math.h>
 #include "utils.h"
 
-#define HUGE_VAL        3.4028234e38
-
 /*
  * IEEE 32-bit single precision floating point numbers are represented:
  *
@@ -46,198 +44,458 @@ float floorf( float in )
    return x-1;
 }
 
+// Math functions come in two tiers.
+//
+// The standard names (expf, exp2f, logf, log2f, powf, atanf, atan2f)
+// are the precise tier.  They handle NaN, infinity, zero and denormal
+// inputs the way the C library does.  atanf and atan2f are within
+// 3.5 ULP of the correctly rounded result and the rest within 1.5 ULP.
+//
+// The Fast... functions skip most special case handling and use
+// shorter polynomials.  They're meant for signal processing in the
+// loop where the inputs are known to be reasonable.  Their errors are
+// bounded, but a few times larger; the limits are given with each one.
+//
+// sqrtf and fabsf are single FPU instructions and exact, so there's
+// only one version of those.
+
+#define INFINITY_F      I2F( 0x7F800000 )
+#define NAN_F           I2F( 0x7FC00000 )
+
+// Adding and then subtracting this rounds a float to an integer
+#define ROUND_MAGIC     12582912.0f
+
+// Split constants.  The low parts hold the bits that didn't fit.
+#define LN2_HI          6.9314718246e-01f
+#define LN2_LO         -1.9046542e-09f
+#define LOG2E_HI        1.4426950216e+00f
+#define LOG2E_LO        1.9259630e-08f
+#define TWO_LOG2E_HI    2.8853900433e+00f
+#define TWO_LOG2E_LO    3.8519260e-08f
+#define TWO_LOG2E_3_HI  9.6179670095e-01f
+#define TWO_LOG2E_3_LO -7.0284617e-09f
+#define PI_F            3.14159274101e+00f
+#define PI_2_F          1.57079637051e+00f
+#define PI_4_F          7.85398185253e-01f
+
+// Multiply by 2^n.  This handles results that overflow or are
+// denormal, which ldexpf doesn't.
+static float Scale2( float x, int n )
+{
+   if( n > 127 )
+   {
+      x *= 0x1p127f;
+      n -= 127;
+      if( n > 127 ) n = 127;
+   }
+   else if( n < -126 )
+   {
+      x *= 0x1p-102f;
+      n += 102;
+      if( n < -126 ) n = -126;
+   }
+   return x * I2F( (n+127) << 23 );
+}
+
+// Find 2^r * 2^n for -0.5 <= r <= 0.5
+static float Exp2Core( float r, int n )
+{
+   float p = ((((( 1.535336188319500e-4f * r + 1.339887440266574e-3f) * r
+                 + 9.618437357674640e-3f) * r + 5.550332471162809e-2f) * r
+                 + 2.402264791363012e-1f) * r + 6.931472028550421e-1f) * r + 1.0f;
+   return Scale2( p, n );
+}
+
+float exp2f( float x )
+{
+   if( x != x ) return x + x;
+   if( x >= 128.0f ) return INFINITY_F;
+   if( x < -150.0f ) return 0.0f;
+
+   // Split into integer and fraction.  The fraction is exact.
+   float k = (x + ROUND_MAGIC) - ROUND_MAGIC;
+   return Exp2Core( x - k, (int)k );
+}
+
+float expf( float x )
+{
+   if( x != x ) return x + x;
+   if( x > 88.7228394f ) return INFINITY_F;
+   if( x < -103.972084f ) return 0.0f;
+
+   // x = k*ln(2) + r with |r| <= ln(2)/2.  ln(2) is applied in two
+   // parts so the reduction is accurate even for large k.
+   float k = (x * LOG2E_HI + ROUND_MAGIC) - ROUND_MAGIC;
+   float r = fmaf( -k, LN2_HI, x );
+   r = fmaf( -k, LN2_LO, r );
+
+   float p = ((((( 1.9875691500e-4f * r + 1.3981999507e-3f) * r
+                 + 8.3334519073e-3f) * r + 4.1665795894e-2f) * r
+                 + 1.6666665459e-1f) * r + 5.0000001201e-1f) * r * r + r + 1.0f;
+   return Scale2( p, (int)k );
+}
+
+// Split a positive, finite x into 2^k * (1+f) with sqrt(0.5) <= 1+f < sqrt(2).
+// Returns f.
+static float LogReduce( float x, int *k )
+{
+   uint32_t ix = F2I(x);
+   int e = 0;
+
+   // Denormals are scaled up first
+   if( ix < 0x00800000 )
+   {
+      ix = F2I( x * 0x1p25f );
+      e = -25;
+   }
+
+   ix -= 0x3F3504F3;
+   *k = e + ((int32_t)ix >> 23);
+   return I2F( (ix & 0x007FFFFF) + 0x3F3504F3 ) - 1.0f;
+}
+
+// log(1+f) - f for sqrt(0.5) <= 1+f < sqrt(2)
+static float LogPoly( float f )
+{
+   float z = f * f;
+   float y = (((((((( 7.0376836292e-2f * f - 1.1514610310e-1f) * f
+                    + 1.1676998740e-1f) * f - 1.2420140846e-1f) * f
+                    + 1.4249322787e-1f) * f - 1.6668057665e-1f) * f
+                    + 2.0000714765e-1f) * f - 2.4999993993e-1f) * f
+                    + 3.3333331174e-1f) * f * z;
+   return y - 0.5f * z;
+}
+
 /****************************************************************************
- *  POW() - Power
+ *  LOG() - natural log
+ *
+ *  Based on the algorithm from "Software Manual for the Elementary
+ *  Functions", Cody and Waite, Prentice Hall 1980, chapter 5.
  *
- *  z = mantissa x
- *  log2(z) = c1 * z ^ 9 + c2 * z ^ 7 + c3 * z ^ 5 + c4 * z ^ 3 + c5 * z
- *  log2(x) = exponent x + log2(z)
- *  a = y * log2(x)
- *  b = mantissa a
- *  2 ^ b =  (((((d1 * b + d2) * b + d3) * b + d4) * b + d5) * b + d6)
+ *  x = 2^k * (1+f),  sqrt(0.5) <= 1+f < sqrt(2)
+ *  log(x) = k * ln(2) + f + polynomial(f)
  *
- *  result = 2 ^ exponent a * 2 ^ b
- *         = 2 ^ (y * log2(x))
+ *  ln(2) is split in two so the k term doesn't lose accuracy.
  ****************************************************************************/
-float powf(float x, float y)
+float logf( float x )
+{
+   if( x != x ) return x + x;
+   if( x == 0.0f ) return -INFINITY_F;
+   if( x < 0.0f ) return NAN_F;
+   if( x == INFINITY_F ) return x;
+
+   int k;
+   float f = LogReduce( x, &k );
+   float y = LogPoly( f );
+
+   // ln(2) split so the high part times k is exact
+#define C3        0.693359375f
+#define C4       -2.12194440e-4f
+   return (k * C4 + y) + f + k * C3;
+}
+
+float log2f( float x )
+{
+   if( x != x ) return x + x;
+   if( x == 0.0f ) return -INFINITY_F;
+   if( x < 0.0f ) return NAN_F;
+   if( x == INFINITY_F ) return x;
+
+   int k;
+   float f = LogReduce( x, &k );
+   float y = LogPoly( f );
+
+   // (f + y) / ln(2), keeping the extra bits of log2(e)
+   float z = y * LOG2E_HI + (f + y) * LOG2E_LO;
+   z = fmaf( f, LOG2E_HI, z );
+   return z + k;
+}
+
+// log2(x) to about 30 bits, returned as hi + *lo.  This is what powf
+// needs to keep its result accurate for large exponents.  x must be
+// positive and finite.
+static float Log2Ext( float x, float *lo )
+{
+   int k;
+   float f = LogReduce( x, &k );
+
+   // log2(1+f) = 2/ln(2) * atanh(s), with s = f / (2+f).  The
+   // division is done to double precision using the exact remainder.
+   float d = f + 2.0f;
+   float dlo = f - (d - 2.0f);
+   float s = f / d;
+   float rem = fmaf( -s, d, f );
+   rem = fmaf( -s, dlo, rem );
+   float slo = rem / d;
+
+   // 2/ln(2) * (s + s^3/3 + s^5/5 + ...).  The first two terms are also
+   // carried to double precision.  The rest are under 0.02% of the total
+   // so single precision is plenty.
+   float z = s * s;
+   float zlo = fmaf( s, s, -z );
+   float s3 = z * s;
+   float s3lo = fmaf( z, s, -s3 ) + zlo * s + 3 * z * slo;
+
+   float rest = ((( 2.62308189e-1f * z + 3.20598898e-1f) * z
+                   + 4.12198583e-1f) * z + 5.77078016e-1f) * z * s3;
+
+   float p = TWO_LOG2E_HI * s;
+   float plo = fmaf( TWO_LOG2E_HI, s, -p ) + (TWO_LOG2E_LO * s + TWO_LOG2E_HI * slo);
+
+   float q = TWO_LOG2E_3_HI * s3;
+   float qlo = fmaf( TWO_LOG2E_3_HI, s3, -q ) + (TWO_LOG2E_3_LO * s3 + TWO_LOG2E_3_HI * s3lo);
+
+   // q is always the smaller of the two
+   float sum = p + q;
+   plo += ((p - sum) + q) + qlo + rest;
+   p = sum;
+
+   // Add in k.  When k isn't zero it's larger than p, so this
+   // gets the rounding error exactly.
+   float hi = k + p;
+   plo += ((float)k - hi) + p;
+
+   float h = hi + plo;
+   *lo = plo - (h - hi);
+   return h;
+}
+
+// Classify a float as an integer.  Returns 0 if it isn't one,
+// 1 for odd integers and 2 for even ones.
+static int IntType( float y )
 {
-    float x2;
-    int n;
-    int sign = 0;
-    int iy = (int)y;
-
-    /* 0 ^^ n, n < 0 => 1 / 0 ^^ n => 1 / 0 => error */
-    if ((x == 0.0) && (y <= 0.0))
-        return 0.0;
-    
-    /* x ^^ 0 = 1.0 */
-    if (y == 0.0) return (1.0);
-    
-    /* x ^^ 1 = x */
-    if (y == 1.0) return (x);
-    
-    /* 1 ^^ y = 1.0 */
-    if (x == 1.0) return(1.0);
-    
-    /* -1 ^^ y = -1.0 if y is odd integer, return 1.0 if y is even. */
-    /* -1 ^^ 0 handled before we get here.                          */
-    if ((x == -1.0) && (y == iy)) return (iy & 1) ? -1.0 : 1.0;
-    
-    /* 0 ^^ n => 0, n > 0 */
-    if (x == 0.0)
-        return 0.0;
-    
-    /* 2 ^^ y (times 1.0)*/
-    if ((x == 2.0) && (y == iy)) return ldexpf(1.0, iy);
-    if ((x == -2.0) && (y == iy)) return (iy & 1) ? -ldexpf(1.0, iy) : ldexpf(1.0, iy);
-    
-    if (x < 0.0)
-    {
-        /*****************************************************************/
-        /* if y is not an integer, a domain error occurs                 */
-        /*****************************************************************/
-        if ((y - iy) != 0.0) 
-            return 0.0; 
-        
-        /*****************************************************************/
-        /* if x < 0, compute the power of |x|                            */
-        /*****************************************************************/
-        x = -x;
-        
-        /*****************************************************************/
-        /* for odd exponents, negate the answer                          */
-        /*****************************************************************/
-        if (iy & 1)
-            sign = 1;
-    }
-    
-    /***************************************************************/
-    /* x = mantissa of x, n = exponent of x                        */
-    /***************************************************************/
-    x = 2.0 * frexpf(x, &n);
-    --n;
-    
-    /***************************************************************/
-    /* log2(x) is approximately (x - sqrt(2) / x + sqrt(2))        */
-    /***************************************************************/
-#define SQRTWO 1.4142135623730951
-#define L1        2.885390072738
-#define L3        0.961800762286
-#define L5        0.576584342056
-#define L7        0.434259751292
-#define T6        0.0002082045327
-#define T5        0.001266912225
-#define T4        0.009656843287
-#define T3        0.05549288453
-#define T2        0.2402279975
-#define T1        0.6931471019
-    x  = (x - SQRTWO) / (x + SQRTWO);
-    x2 = x * x;
-    
-    /***************************************************************/
-    /* polynomial expansion for log2(x)                            */
-    /***************************************************************/
-    x = ((((L7 * x2 + L5) * x2 + L3) * x2 + L1) * x + 0.5);
-    
-    /***************************************************************/
-    /* log2(x) = log2(mantissa(x)) + exponent(x)                   */
-    /***************************************************************/
-    x += n;
-    
-    /***************************************************************/
-    /* x = y * log2(x)                                             */
-    /* n = integer part of x                                       */
-    /* x = fractional part of x                                    */
-    /***************************************************************/
-    x *= y;
-    n  = x;
-    if ((x -= n) < 0) 
-    { 
-        x += 1.0; 
-        n -= 1; 
-    }
-    
-    /***************************************************************/
-    /* polynomial expansion for 2 ^ x                              */
-    /***************************************************************/
-    x = ((((((T6 * x + T5) * x + T4) * x + T3) * x + T2) * x + T1) * x + 1.0);
-    
-    x = ldexpf(x, n);
-    return (sign) ? -x : x;
+   uint32_t iy = F2I(y);
+   int e = ((iy >> 23) & 0xFF) - 127;
+
+   if( e < 0 ) return (iy << 1) ? 0 : 2;
+   if( e >= 24 ) return 2;
+   if( iy & (0x007FFFFF >> e) ) return 0;
+   return ((iy >> (23-e)) & 1) ? 1 : 2;
 }
 
 /****************************************************************************
- *  LOG() - natural log
+ *  POW() - Power
  *
- *  Based on the algorithm from "Software Manual for the Elementary
- *  Functions", Cody and Waite, Prentice Hall 1980, chapter 5.
+ *  pow(x,y) = 2 ^ (y * log2(x))
  *
- *  N = exponent x
- *  f = mantissa x, 0.5 <= f < 1
- *  if f < sqrt(0.5), znum = f - 0.5, zden = znum * 0.5 + 0.5
- *  if f > sqrt(0.5), znum = f - 1, zden = f * 0.5 + 0.5
- *  z = znum / zden
- *  w = z * z
- *  R = polynomial expression
+ *  The product y * log2(x) is carried to about 30 bits since any error
+ *  in it is scaled by the size of the result's exponent.
+ ****************************************************************************/
+float powf( float x, float y )
+{
+   // x^0 and 1^y are 1, even for NaN
+   if( (y == 0.0f) || (x == 1.0f) )
+      return 1.0f;
+
+   if( (x != x) || (y != y) )
+      return x + y;
+
+   // Negative x is only allowed for integer powers
+   int neg = 0;
+   if( F2I(x) >> 31 )
+   {
+      int type = IntType( y );
+      if( !type && (x != 0.0f) && !isinff(x) )
+         return NAN_F;
+
+      neg = (type == 1);
+      x = -x;
+   }
+
+   float ret;
+   if( x == 0.0f )
+      ret = (y < 0.0f) ? INFINITY_F : 0.0f;
+
+   else if( x == INFINITY_F )
+      ret = (y < 0.0f) ? 0.0f : INFINITY_F;
+
+   else if( x == 1.0f )
+      ret = 1.0f;
+
+   else
+   {
+      float lo;
+      float hi = Log2Ext( x, &lo );
+
+      // hi can round up to exactly 128 for results just below the
+      // largest float, so leave some margin when checking for overflow.
+      float t = y * hi;
+      if( t > 128.5f )
+         ret = INFINITY_F;
+      else if( t < -150.5f )
+         ret = 0.0f;
+      else
+      {
+         float tlo = fmaf( y, hi, -t ) + y * lo;
+         float k = (t + ROUND_MAGIC) - ROUND_MAGIC;
+         ret = Exp2Core( (t - k) + tlo, (int)k );
+      }
+   }
+
+   return neg ? -ret : ret;
+}
+
+// Arc tangent for 0 <= x <= tan(pi/8)
+static float AtanPoly( float x )
+{
+   float z = x * x;
+   return ((( 8.05374449538e-2f * z - 1.38776856032e-1f) * z
+             + 1.99777106478e-1f) * z - 3.33329491539e-1f) * z * x + x;
+}
+
+/****************************************************************************
+ *  ATAN() - Arc tangent
  *
- *  result = R + N * ln(2)
+ *  From the Cephes library.  The argument is reduced to [0, tan(pi/8)]
+ *  using atan(x) = pi/2 - atan(1/x) and atan(x) = pi/4 + atan((x-1)/(x+1))
+ ****************************************************************************/
+float atanf( float x )
+{
+   if( x != x ) return x + x;
+
+   float a = fabsf( x );
+   float y;
+
+   if( a > 2.414213562373095f )
+      y = PI_2_F + AtanPoly( -1.0f / a );
+   else if( a > 0.4142135623730950f )
+      y = PI_4_F + AtanPoly( (a - 1.0f) / (a + 1.0f) );
+   else
+      y = AtanPoly( a );
+
+   // The sign bit is tested so that -0 gives -0
+   return (F2I(x) >> 31) ? -y : y;
+}
+
+float atan2f( float y, float x )
+{
+   if( (x != x) || (y != y) )
+      return x + y;
+
+   int yneg = F2I(y) >> 31;
+   int xneg = F2I(x) >> 31;
+
+   if( y == 0.0f )
+   {
+      float r = xneg ? PI_F : 0.0f;
+      return yneg ? -r : r;
+   }
+
+   if( x == 0.0f )
+      return yneg ? -PI_2_F : PI_2_F;
+
+   float r;
+   if( isinff(x) )
+   {
+      if( isinff(y) )
+         r = xneg ? 3*PI_4_F : PI_4_F;
+      else
+         r = xneg ? PI_F : 0.0f;
+   }
+   else if( isinff(y) )
+      r = PI_2_F;
+   else
+   {
+      r = atanf( fabsf( y / x ) );
+      if( xneg ) r = PI_F - r;
+   }
+
+   return yneg ? -r : r;
+}
+
+/****************************************************************************
+ *  Fast tier
  ****************************************************************************/
-float logf(float x)
+
+// 2^x.  Inputs are clamped to the normal float range, so results
+// are between 2^-126 and about 3.4e38.  NaN isn't handled.
+// Error is under 3 ULP.
+float FastExp2( float x )
+{
+   if( x < -126.0f ) x = -126.0f;
+   if( x > 127.99999f ) x = 127.99999f;
+
+   float k = (x + ROUND_MAGIC) - ROUND_MAGIC;
+   float f = x - k;
+
+   // The exponent is added straight into the result's bits
+   float p = (((( 1.3264723821e-3f * f + 9.6715129912e-3f) * f
+                + 5.5507335812e-2f) * f + 2.4022242427e-1f) * f
+                + 6.9314700365e-1f) * f + 1.0f;
+   return I2F( F2I(p) + ((uint32_t)(int)k << 23) );
+}
+
+// e^x, with the same limits as FastExp2.  Error is under 3 ULP.
+float FastExp( float x )
+{
+   // Carry the bits of x*log2(e) lost to rounding into the fraction
+   float t = x * LOG2E_HI;
+   float tlo = fmaf( x, LOG2E_HI, -t ) + x * LOG2E_LO;
+
+   if( t < -126.0f ) t = -126.0f;
+   if( t > 127.99999f ) t = 127.99999f;
+
+   float k = (t + ROUND_MAGIC) - ROUND_MAGIC;
+   float f = (t - k) + tlo;
+
+   float p = (((( 1.3264723821e-3f * f + 9.6715129912e-3f) * f
+                + 5.5507335812e-2f) * f + 2.4022242427e-1f) * f
+                + 6.9314700365e-1f) * f + 1.0f;
+   return I2F( F2I(p) + ((uint32_t)(int)k << 23) );
+}
+
+// log2(x) for positive, normal x.  Other inputs give meaningless
+// results.  Error is under 6 ULP.
+float FastLog2( float x )
+{
+   uint32_t ix = F2I(x) - 0x3F3504F3;
+   int k = (int32_t)ix >> 23;
+   float m = I2F( (ix & 0x007FFFFF) + 0x3F3504F3 );
+
+   float s = (m - 1.0f) / (m + 1.0f);
+   float z = s * s;
+   return (( 5.9577548504e-1f * z + 9.6158850193e-1f) * z + 2.8853905201e+00f) * s + k;
+}
+
+// Natural log with the same limits as FastLog2.  Error is under 6 ULP.
+float FastLog( float x )
+{
+   return FastLog2( x ) * LN2_HI;
+}
+
+// x^y for positive, normal x.  The error grows with the size of the
+// result's exponent, from a few ULP near 1 to about 400 ULP near the
+// ends of the float range.
+float FastPow( float x, float y )
+{
+   return FastExp2( y * FastLog2( x ) );
+}
+
+// Arc tangent in radians.  Absolute error is under 1e-6 and
+// relative error under 12 ULP.
+float FastAtan2( float y, float x )
+{
+   float ax = fabsf( x );
+   float ay = fabsf( y );
+
+   float mx = (ax > ay) ? ax : ay;
+   float mn = (ax > ay) ? ay : ax;
+
+   // Odd polynomial for atan on [0, 1]
+   float a = (mx > 0.0f) ? mn / mx : 0.0f;
+   float z = a * a;
+   float r = ((((( 8.1063285470e-3f * z - 3.7796609104e-2f) * z
+                 + 8.4840923548e-2f) * z - 1.3544569910e-1f) * z
+                 + 1.9897872210e-1f) * z - 3.3328491449e-1f) * z * a + a;
+
+   if( ay > ax ) r = PI_2_F - r;
+   if( F2I(x) >> 31 ) r = PI_F - r;
+   return (F2I(y) >> 31) ? -r : r;
+}
+
+float FastAtan( float x )
 {
-    int n;
-    float a, b, f, r, w, z, znum;
-
-    /************************************************************************/
-    /* check for errors in domain and range                                 */
-    /************************************************************************/
-    if (x <= 0) { return (-HUGE_VAL); }
-
-    /************************************************************************/
-    /* f = mantissa(x), n = exponent(x)                            */
-    /************************************************************************/
-    f = frexpf(x, &n);
-
-    /************************************************************************/
-    /* for numbers <= sqrt(0.5)                                             */
-    /************************************************************************/
-    if (f <= 0.7071067811865476f )
-    {
-        --n;
-        znum = f - 0.5;
-        z    = znum / (znum * 0.5 + 0.5);
-    }
-
-    /************************************************************************/
-    /* for numbers > sqrt(0.5)                                              */
-    /************************************************************************/
-    else
-    {
-        znum = (f - 0.5) - 0.5;
-        z    = znum / (f * 0.5 + 0.5);
-    }
-
-    /************************************************************************/
-    /* determine polynomial expression                                      */
-    /************************************************************************/
-    w = z * z;
-
-#define SQRTHALF  0.70710678118654752440
-#define C3        0.693359375
-#define C4       -2.121944400546905827679e-4
-#define A0       -0.5527074855
-#define B0       -0.6632718214e1
-    a = A0;
-    b = w + B0;
-
-    /************************************************************************/
-    /* calculate the natural log of (mant x) / 2                            */
-    /************************************************************************/
-    r = z + z * w * (a / b);
-
-    /************************************************************************/
-    /* ln(x) = ln (mant x) + 2 * (exp x) (but more mathematically stable)   */
-    /************************************************************************/
-    return ((n * C4 + r) + n * C3);
+   return FastAtan2( x, 1.0f );
 }
 
 float log10f(float x)
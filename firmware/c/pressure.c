@@ -35,13 +35,12 @@
 
 // local functions
 static void SelectSensor( int which );
-static int SetOffsetTime( VarInfo *info, uint8_t *buff, int len );
-static int SetPresOff( VarInfo *info, uint8_t *buff, int len );
-static int SetCalData( VarInfo *info, uint8_t *buff, int len );
-static int GetCalData( VarInfo *info, uint8_t *buff, int len );
-static int GetVarFlow( VarInfo *info, uint8_t *buff, int max );
-static int GetP1CmH2O( VarInfo *info, uint8_t *buff, int max );
-static int GetP2CmH2O( VarInfo *info, uint8_t *buff, int max );
+static int SetOffsetTime( VarInfo *info, uint8_t *buff, int off, int len );
+static int SetPresOff( VarInfo *info, uint8_t *buff, int off, int len );
+static int SetCalData( VarInfo *info, uint8_t *buff, int off, int len );
+static int GetVarFlow( VarInfo *info, uint8_t *buff, int off, int len );
+static int GetP1CmH2O( VarInfo *info, uint8_t *buff, int off, int len );
+static int GetP2CmH2O( VarInfo *info, uint8_t *buff, int off, int len );
 
 // local data
 static uint16_t isrLastRead;
@@ -68,20 +67,23 @@ void InitPressure( void )
    VarInit( &varPressure[1], VARID_PRESSURE2,   "pressure2", VAR_TYPE_FLOAT, &padj[1], VAR_FLG_READONLY );
    VarInit( &varPoffset[0],  VARID_POFF1,       "poff1",     VAR_TYPE_INT32, &pOff[0], 0 );
    VarInit( &varPoffset[1],  VARID_POFF2,       "poff2",     VAR_TYPE_INT32, &pOff[1], 0 );
-   VarInit( &varPresCal,     VARID_PCAL,        "prescal",   VAR_TYPE_ARY32, &calData, 0 );
+   VarInitAry( &varPresCal,  VARID_PCAL,        "prescal",   VAR_TYPE_ARYFLT, calData, CAL_POINTS, 0 );
    VarInit( &varOffCalc,     VARID_POFF_CALC,   "poffcalc",  VAR_TYPE_INT16, &offCalcTime, 0 );
    VarInit( &varFlow,        VARID_FLOW,        "flow",      VAR_TYPE_FLOAT, 0, VAR_FLG_READONLY );
 
    varOffCalc.set = SetOffsetTime;
    varPresCal.set = SetCalData;
-   varPresCal.get = GetCalData;
-   varPresCal.size = 4*CAL_POINTS;
    varPoffset[0].set = SetPresOff;
    varPoffset[1].set = SetPresOff;
    varFlow.get       = GetVarFlow;
    varPressure[0].get = GetP1CmH2O;
    varPressure[1].get = GetP2CmH2O;
 
+   varPressure[0].units = "cmH2O";
+   varPressure[1].units = "cmH2O";
+   varPresCal.units     = "kPa";
+   varFlow.units        = "ml/sec";
+
    // Configure the pins for SPI use
    GPIO_PinAltFunc( DIGIO_A_BASE, 6, 5 );
    GPIO_PinAltFunc( DIGIO_B_BASE, 3, 5 );
@@ -167,24 +169,24 @@ float GetFlowRate( void )
    return 100 * ARRAY_CT(calData);
 }
 
-static int GetVarFlow( VarInfo *info, uint8_t *buff, int max )
+static int GetVarFlow( VarInfo *info, uint8_t *buff, int off, int len )
 {
    // Make sure there's at least two bytes of space in the passed buffer
-   if( max < sizeof(int32_t) )
+   if( len < sizeof(int32_t) )
       return ERR_MISSING_DATA;
 
    flt_2_u8( GetFlowRate(), buff );
    return ERR_OK;
 }
 
-static int GetP1CmH2O( VarInfo *info, uint8_t *buff, int max )
+static int GetP1CmH2O( VarInfo *info, uint8_t *buff, int off, int len )
 {
    float p = RawPressureToKpa( padj[0] ) * PRESSURE_CM_H2O;
    flt_2_u8( p, buff );
    return ERR_OK;
 }
 
-static int GetP2CmH2O( VarInfo *info, uint8_t *buff, int max )
+static int GetP2CmH2O( VarInfo *info, uint8_t *buff, int off, int len )
 {
    float p = RawPressureToKpa( padj[1] ) * PRESSURE_CM_H2O;
    flt_2_u8( p, buff );
@@ -300,9 +302,9 @@ static void SelectSensor( int which )
       BusyWait( 3 );
 }
 
-static int SetOffsetTime( VarInfo *info, uint8_t *buff, int len )
+static int SetOffsetTime( VarInfo *info, uint8_t *buff, int off, int len )
 {
-   int err = VarSet16( info, buff, len );
+   int err = VarSet16( info, buff, off, len );
    if( err ) return err;
 
    IntDisable();
@@ -316,9 +318,9 @@ static int SetOffsetTime( VarInfo *info, uint8_t *buff, int len )
 
 // This is called when one of the pressure offset variables are changed
 // It saves the value stored in flash
-static int SetPresOff( VarInfo *info, uint8_t *buff, int len )
+static int SetPresOff( VarInfo *info, uint8_t *buff, int off, int len )
 {
-   int err = VarSet32( info, buff, len );
+   int err = VarSet32( info, buff, off, len );
    if( !err )
    {
       StoreUpdt( pOff, pOff, sizeof(pOff) );
@@ -328,28 +330,12 @@ static int SetPresOff( VarInfo *info, uint8_t *buff, int len )
 }
 
 // Set the calibration data for the pressure difference.
-// I expect 20 x 32-bit integers, so 80 bytes of data
-static int SetCalData( VarInfo *info, uint8_t *buff, int len )
-{
-   if( len < 4*CAL_POINTS )
-      return ERR_MISSING_DATA;
-
-   for( int i=0; i<CAL_POINTS; i++ )
-      calData[i] = b2flt( &buff[4*i] );
-
-   StoreUpdt( pcal, calData, 4*CAL_POINTS );
-
-   return 0;
-}
-
-static int GetCalData( VarInfo *info, uint8_t *buff, int max )
+// The standard array function updates the table, I just
+// need to save the new values to flash afterward.
+static int SetCalData( VarInfo *info, uint8_t *buff, int off, int len )
 {
-   // Make sure there's at least two bytes of space in the passed buffer
-   if( max < 4*CAL_POINTS )
-      return ERR_MISSING_DATA;
-
-   for( int i=0; i<CAL_POINTS; i++ )
-      flt_2_u8( calData[i], &buff[4*i] );
+   int err = VarSetAry( info, buff, off, len );
+   if( err ) return err;
 
-   return ERR_OK;
+   return StoreUpdt( pcal, calData, 4*CAL_POINTS );
 }
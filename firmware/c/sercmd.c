@@ -13,10 +13,38 @@
 // For example, to send ESC you would send ESC ESC.  To send EOC you would send ESC EOC.
 //
 // The serial port starts in ASCII mode at power-up.
+//
+// Binary commands can also be sent using a second version of the framing,
+// selected by the CMD_SET_PROTO command.  Version 2 frames are COBS encoded
+// and terminated by a zero byte, so the end of a frame can always be found
+// without any escape state.  After decoding, a frame looks like this:
+//   <seq> <cmd> <flags> <data>... <crc32>
+// The sequence byte is chosen by the host and returned unchanged with the
+// response, which has the same layout with the command code replaced by
+// the error code.  The flags byte is reserved and should be zero.  The CRC
+// is calculated over everything before it using the hardware CRC unit
+// (see crc.c) and is sent little endian.
+//
+// With version 2 the host doesn't have to wait for a response before
+// sending the next command.  Up to SERCMD_QUEUE_LEN commands are queued
+// and processed in the order they were received.  Frames that fail the
+// CRC check are answered with ERR_CKSUM so the host can retry them.
+//
+// The response to a CMD_READ_BULK command is followed by the memory it
+// asked for, sent as a series of frames using the channel's framing.
+// Each holds up to SERCMD_BULK_CHUNK bytes, as the data of an ordinary
+// successful response (with the command's sequence byte for version 2).
+// One more frame then holds the CRC-32 of all the data.  The data is
+// read straight from memory as it's sent and only as fast as the
+// transport's transmit buffer empties, so no other flow control is
+// needed.  The CRC is calculated as each frame is started, so a
+// mismatch also shows if the memory changed while it was being sent.
 
 #include "ascii.h"
 #include "binary.h"
 #include "cpu.h"
+#include "crc.h"
+#include "errors.h"
 #include "sercmd.h"
 #include "string.h"
 #include "uart.h"
@@ -30,6 +58,14 @@
 // Flag bits
 #define FLG_BINARY              0x01   // Set when running in binary mode
 #define FLG_ESC                 0x02   // Set if the last byte was an ESC
+#define FLG_TX_ESC              0x04   // Set if an ESC was sent and the byte it escapes is still pending
+#define FLG_RX_ZERO             0x08   // Set if the COBS block being received ends with a zero
+#define FLG_RX_OVER             0x10   // Set if the frame being received didn't fit in the buffer
+#define FLG_TX_BLK              0x20   // Set while sending the data bytes of a COBS block
+#define FLG_TX_END              0x40   // Set once the frame has been sent except for its delimiter
+#define FLG_BULK                0x80   // Set while sending the data from a bulk read
+#define FLG_BULK_CRC            0x100  // Set once the final frame of a bulk read has been started
+#define FLG_TX_ZERO             0x200  // Set if the COBS block being sent ends with a zero
 
 // States
 #define START_NEW_CMD           0
@@ -37,28 +73,69 @@
 #define STATE_WAIT_BINARY       2
 #define STATE_SEND_ASCII_RSP    3
 #define STATE_SEND_BINARY_RSP   4
+#define STATE_SEND_FRAME        5
+
+// Version 2 frames carry a sequence and flags byte in front
+// of the command and a four byte CRC after it.
+#define FRAME_HDR_LEN           1
+#define FRAME_CRC_LEN           4
+
+// Longest run of data bytes in one COBS block
+#define COBS_MAX_RUN            254
+
+// local functions
+static void SetProto( SerCmdInfo *info, int proto );
+static void PollFramed( SerCmdInfo *info );
+static void RecvFrames( SerCmdInfo *info );
+static void FrameDone( SerCmdInfo *info );
+static void ProcessFrame( SerCmdInfo *info );
+static int SendFrame( SerCmdInfo *info );
+static void StartRsp( SerCmdInfo *info, const uint8_t *rsp, int len );
+static void ChanCmdDone( SerCmdInfo *info, int op, uint8_t *rsp, int len );
+static int NextBulkFrame( SerCmdInfo *info );
 
 void InitSerCmd( SerCmdInfo *info, int usb )
 {
    info->usb    = usb;
-   info->state  = 0;
    info->flag   = 0;
-   info->cmdNdx = 0;
-   info->rspLen = 0;
+   SetProto( info, 1 );
 }
 
-static inline int SendByte( SerCmdInfo *info, uint8_t ch )
+// Switch to a new version of the binary framing.
+// Any partially received commands are discarded.
+static void SetProto( SerCmdInfo *info, int proto )
 {
-   if( info->usb )
-      return USB_SendByte( ch );
-   else
-      return UART_SendByte( ch );
+   info->proto    = proto;
+   info->newProto = 0;
+   info->state    = START_NEW_CMD;
+   info->flag    &= FLG_BINARY;
+   info->code     = 0;
+   info->txBlk    = 0;
+   info->rxSlot   = 0;
+   info->txSlot   = 0;
+   info->queued   = 0;
+   info->cmdNdx   = 0;
+   info->rspNdx   = 0;
+   info->rspLen   = 0;
+}
+
+// Return the byte at offset ndx of the frame being sent
+static inline uint8_t FrameByte( SerCmdInfo *info, int ndx )
+{
+   if( ndx < info->hdrLen )
+      return info->frm[ndx];
+
+   ndx -= info->hdrLen;
+   if( ndx < info->srcLen )
+      return info->src[ndx];
+
+   return info->frm[ info->hdrLen + ndx - info->srcLen ];
 }
 
 static inline int SendData( SerCmdInfo *info, uint8_t *data, int len )
 {
    if( info->usb )
-      return USB_Send( data, len );
+      return USB_Send( info->usb-1, data, len );
    else
       return UART_Send( data, len );
 }
@@ -66,36 +143,74 @@ static inline int SendData( SerCmdInfo *info, uint8_t *data, int len )
 static inline int RecvByte( SerCmdInfo *info )
 {
    if( info->usb )
-      return USB_Recv();
+      return USB_Recv( info->usb-1 );
    else
       return UART_Recv();
 }
 
-static inline int TxFree( SerCmdInfo *info )
+static inline int RxSpan( SerCmdInfo *info, uint8_t **ptr )
 {
    if( info->usb )
-      return USB_TxFree();
+      return USB_RxSpan( info->usb-1, ptr );
    else
-      return UART_TxFree();
+      return UART_RxSpan( ptr );
+}
+
+static inline void RxDone( SerCmdInfo *info, int ct )
+{
+   if( info->usb )
+      USB_RxDone( info->usb-1, ct );
+   else
+      UART_RxDone( ct );
+}
+
+static inline int TxSpan( SerCmdInfo *info, uint8_t **ptr )
+{
+   if( info->usb )
+      return USB_TxSpan( info->usb-1, ptr );
+   else
+      return UART_TxSpan( ptr );
+}
+
+static inline void TxDone( SerCmdInfo *info, int ct )
+{
+   if( info->usb )
+      USB_TxDone( info->usb-1, ct );
+   else
+      UART_TxDone( ct );
 }
 
 
 // This function is constantly called from the background task.
 // It reads bytes from the UART and detects the end of a command.
 // When a new command has been received, it passes it to the command
-// processor and then sends the response back out the UART
+// processor and then sends the response back out the UART.
+// At most one command is processed per call, so several channels
+// can be polled in turn without one starving the others.
 void PollSerCmd( SerCmdInfo *info )
 {
    // NOTE - I'm planning to add support for an ASCII interface in the future, 
    // but for right now I'm just supporting the binary one.
    info->flag |= FLG_BINARY;
 
+   if( info->proto == 2 )
+   {
+      PollFramed( info );
+      return;
+   }
+
    switch( info->state )
    {
       // Start of a new command.
       // In ASCII mode we discard any white space at the start of a command.
       // In binary mode we just jump to the next state
       case START_NEW_CMD:
+         if( info->newProto )
+         {
+            SetProto( info, info->newProto );
+            return;
+         }
+
          info->cmdNdx = 0;
          if( info->flag & FLG_BINARY )
             info->state = STATE_WAIT_BINARY;
@@ -113,7 +228,7 @@ void PollSerCmd( SerCmdInfo *info )
 
             // For non white space, add to my command buffer
             // and move on to the next state
-            info->buff[0] = ch;
+            info->buff[0][0] = ch;
             info->cmdNdx = 1;
             info->state = STATE_WAIT_ASCII;
          }
@@ -128,16 +243,16 @@ void PollSerCmd( SerCmdInfo *info )
 
          if( strchr( "\n\r", ch ) )
          {
-            info->buff[ info->cmdNdx ] = 0;
+            info->buff[0][ info->cmdNdx ] = 0;
 
-            info->rspLen = ProcessAsciiCmd( (char*)info->buff, sizeof(info->buff) );
+            info->rspLen = ProcessAsciiCmd( (char*)info->buff[0], SERCMD_BUFF_LEN );
             info->cmdNdx = 0;
             info->state = STATE_SEND_ASCII_RSP;
             return;
          }
 
-         if( info->cmdNdx < sizeof(info->buff) )
-            info->buff[ info->cmdNdx++ ] = ch;
+         if( info->cmdNdx < SERCMD_BUFF_LEN )
+            info->buff[0][ info->cmdNdx++ ] = ch;
          return;
       }
 
@@ -146,7 +261,7 @@ void PollSerCmd( SerCmdInfo *info )
       {
          // Add as many bytes as possible to the UART 
          // transmit buffer
-         int ct = SendData( info, &info->buff[ info->cmdNdx ], info->rspLen );
+         int ct = SendData( info, &info->buff[0][ info->cmdNdx ], info->rspLen );
          info->rspLen -= ct;
          info->cmdNdx += ct;
          if( !info->rspLen )
@@ -154,83 +269,449 @@ void PollSerCmd( SerCmdInfo *info )
          return;
       }
 
+      // Receiving a binary command.
+      // I work directly on the data in the transport's receive buffer
+      // rather then reading a byte at a time.  Escape characters are
+      // removed as the data is copied into my command buffer.
       case STATE_WAIT_BINARY:
       {
-         int ch = RecvByte( info );
-         if( ch < 0 ) return;
+         uint8_t *dat;
+         int ct;
 
-         // If the previous character received was an escape character
-         // then just save this byte (assuming there's space)
-         if( info->flag & FLG_ESC )
+         while( (ct = RxSpan( info, &dat )) > 0 )
          {
-            info->flag &= ~FLG_ESC;
-            if( info->cmdNdx < sizeof(info->buff) )
-               info->buff[ info->cmdNdx++ ] = ch;
-            return;
-         }
+            int i;
+            int eoc = 0;
+            for( i=0; i<ct; i++ )
+            {
+               uint8_t ch = dat[i];
+
+               // If the previous character received was an escape character
+               // then just save this byte (assuming there's space)
+               if( info->flag & FLG_ESC )
+                  info->flag &= ~FLG_ESC;
+
+               // If this is an escape character, don't save it
+               // just keep track of the fact that we saw it.
+               else if( ch == ESC )
+               {
+                  info->flag |= FLG_ESC;
+                  continue;
+               }
+
+               // If this is an End Of Command character then I'm done.
+               // Any bytes after it belong to the next command so I 
+               // leave them in the receive buffer.
+               else if( ch == EOC )
+               {
+                  i++;
+                  eoc = 1;
+                  break;
+               }
+
+               // Save the byte if there's space in my buffer
+               if( info->cmdNdx < SERCMD_BUFF_LEN )
+                  info->buff[0][ info->cmdNdx++ ] = ch;
+            }
 
-         // If this is an escape character, don't save it
-         // just keep track of the fact that we saw it.
-         if( ch == ESC )
-         {
-            info->flag |= FLG_ESC;
-            return;
-         }
+            RxDone( info, i );
 
-         // If this is an End Of Command character
-         // then process the command
-         if( ch == EOC )
-         {
-            info->rspLen = ProcessBinaryCmd( info->buff, info->cmdNdx, sizeof(info->buff) );
-            info->cmdNdx = 0;
-            info->state = STATE_SEND_BINARY_RSP;
-            return;
-         }
+            if( eoc )
+            {
+               int op = info->buff[0][0];
+               int rsp = ProcessBinaryCmd( info->buff[0], info->cmdNdx, SERCMD_BUFF_LEN );
+               ChanCmdDone( info, op, info->buff[0], rsp );
+               StartRsp( info, info->buff[0], rsp );
 
-         // For other boring characters, just save them 
-         // if there's space in my buffer
-         if( info->cmdNdx < sizeof(info->buff) )
-            info->buff[ info->cmdNdx++ ] = ch;
+               info->cmdNdx = 0;
+               info->state = STATE_SEND_BINARY_RSP;
+               return;
+            }
+         }
          return;
       }
 
-      // Sending a response to a binary command
+      // Sending a response to a binary command.
+      // The response is escaped directly into the free space of
+      // the transport's transmit buffer.
       case STATE_SEND_BINARY_RSP:
+      {
+         uint8_t *out;
+         int ct;
 
-         while( info->rspLen )
+         while( (ct = TxSpan( info, &out )) > 0 )
          {
-            // See what the next character to send is.
-            int ch = info->buff[ info->cmdNdx ];
+            int n = 0;
 
-            // If it's a special character, I need to escape it.
-            // I'll only do that if there are at least two spots 
-            // in the transmit buffer to keep things simple here
-            if( (ch == ESC) || (ch == EOC) )
+            // If an escape character was written at the very end of the
+            // previous block, the byte it escapes goes first in this one.
+            if( info->flag & FLG_TX_ESC )
             {
-               if( TxFree( info ) < 2 )
-                  return;
-               SendByte( info, ESC );
-               SendByte( info, ch );
-               info->cmdNdx++;
-               info->rspLen--;
-            } 
-
-            // Otherwise, just send the byte
-            else if( SendByte( info, ch ) )
+               info->flag &= ~FLG_TX_ESC;
+               out[n++] = FrameByte( info, info->rspNdx++ );
+            }
+
+            while( (info->rspNdx < info->rspLen) && (n < ct) )
             {
-               info->rspLen--;
-               info->cmdNdx++;
+               uint8_t ch = FrameByte( info, info->rspNdx );
+
+               // If it's a special character, I need to escape it.
+               if( (ch == ESC) || (ch == EOC) )
+               {
+                  out[n++] = ESC;
+                  if( n == ct )
+                  {
+                     info->flag |= FLG_TX_ESC;
+                     break;
+                  }
+               }
+
+               out[n++] = ch;
+               info->rspNdx++;
             }
-            else
+
+            // If there's no data left to send, then just send the
+            // EOC character and start waiting for the next command
+            // (or send the next frame of a bulk read)
+            if( (info->rspNdx == info->rspLen) && !(info->flag & FLG_TX_ESC) && (n < ct) )
+            {
+               out[n++] = EOC;
+               if( !NextBulkFrame( info ) )
+                  info->state = START_NEW_CMD;
+            }
+
+            TxDone( info, n );
+
+            if( info->state == START_NEW_CMD )
                return;
          }
+         return;
+      }
+   }
+}
 
-         // If there's no data left to send, then just send the
-         // EOC character and start waiting for the next command
-         if( SendByte( info, EOC ) )
-            info->state = START_NEW_CMD;
+// Poll a channel using the version 2 framing.
+// Receiving runs ahead of processing, so commands are queued
+// while the response to an earlier one is still being sent.
+static void PollFramed( SerCmdInfo *info )
+{
+   RecvFrames( info );
 
-         return;
+   // If nothing is being sent, process the oldest queued command.
+   if( (info->state == START_NEW_CMD) && info->queued )
+   {
+      ProcessFrame( info );
+      info->state = STATE_SEND_FRAME;
+   }
+
+   while( (info->state == STATE_SEND_FRAME) && SendFrame( info ) )
+   {
+      // Keep the command's buffer while a bulk read is being sent
+      if( NextBulkFrame( info ) )
+         continue;
+
+      // The response is out, so free its buffer
+      info->txSlot = (info->txSlot + 1) % SERCMD_QUEUE_LEN;
+      info->queued--;
+      info->state = START_NEW_CMD;
+
+      if( info->newProto )
+         SetProto( info, info->newProto );
+   }
+}
+
+// Decode received frames into free queue buffers.
+// When the queue is full I stop reading, and any further bytes
+// are left in the transport's receive buffer.
+static void RecvFrames( SerCmdInfo *info )
+{
+   uint8_t *dat;
+   int ct;
+
+   while( (info->queued < SERCMD_QUEUE_LEN) && ((ct = RxSpan( info, &dat )) > 0) )
+   {
+      uint8_t *buff = info->buff[ info->rxSlot ];
+      int i;
+
+      for( i=0; i<ct; i++ )
+      {
+         uint8_t ch = dat[i];
+
+         // A zero byte always marks the end of a frame
+         if( !ch )
+         {
+            FrameDone( info );
+            if( info->queued == SERCMD_QUEUE_LEN )
+            {
+               i++;
+               break;
+            }
+            buff = info->buff[ info->rxSlot ];
+            continue;
+         }
+
+         // The first byte of each COBS block gives the number of bytes
+         // to the next zero.  The zero that ended the previous block is
+         // only stored once I know another block follows it.
+         if( !info->code )
+         {
+            int zero = info->flag & FLG_RX_ZERO;
+
+            if( ch == COBS_MAX_RUN+1 )
+               info->flag &= ~FLG_RX_ZERO;
+            else
+               info->flag |= FLG_RX_ZERO;
+
+            info->code = ch - 1;
+            if( !zero )
+               continue;
+            ch = 0;
+         }
+         else
+            info->code--;
+
+         if( info->cmdNdx < SERCMD_BUFF_LEN )
+            buff[ info->cmdNdx++ ] = ch;
+         else
+            info->flag |= FLG_RX_OVER;
+      }
+
+      RxDone( info, i );
    }
 }
 
+// Called when a frame delimiter is received.  If the frame is
+// valid it's added to the queue.  Bad frames are queued with a
+// negative length holding the error code to return.
+static void FrameDone( SerCmdInfo *info )
+{
+   uint8_t *buff = info->buff[ info->rxSlot ];
+   int len = info->cmdNdx;
+   int err = ERR_OK;
+
+   // Reset the decoder for the next frame
+   int bad = info->code || (info->flag & FLG_RX_OVER);
+   info->code = 0;
+   info->cmdNdx = 0;
+   info->flag &= ~(FLG_RX_ZERO | FLG_RX_OVER);
+
+   // Empty frames are ignored.  The host can send extra
+   // delimiters to resynchronize.
+   if( !len )
+      return;
+
+   if( len < FRAME_HDR_LEN + 2 + FRAME_CRC_LEN )
+      err = ERR_SHORT_CMD;
+
+   else if( bad || (CalcCRC32( buff, len-FRAME_CRC_LEN ) != b2u32( &buff[len-FRAME_CRC_LEN] )) )
+      err = ERR_CKSUM;
+
+   info->len[ info->rxSlot ] = err ? -err : len - FRAME_CRC_LEN;
+   info->rxSlot = (info->rxSlot + 1) % SERCMD_QUEUE_LEN;
+   info->queued++;
+}
+
+// Process the command at the head of the queue and
+// build its response frame in the same buffer.
+static void ProcessFrame( SerCmdInfo *info )
+{
+   uint8_t *buff = info->buff[ info->txSlot ];
+   int len = info->len[ info->txSlot ];
+   int rsp;
+
+   if( len < 0 )
+      rsp = ReturnErr( &buff[FRAME_HDR_LEN], -len );
+
+   else
+   {
+      int op = buff[FRAME_HDR_LEN];
+
+      rsp = DispatchBinaryCmd( &buff[FRAME_HDR_LEN], len-FRAME_HDR_LEN,
+                               SERCMD_BUFF_LEN-FRAME_HDR_LEN-FRAME_CRC_LEN );
+
+      // Every frame gets a response so the host can match them up
+      if( rsp < 2 )
+         rsp = ReturnErr( &buff[FRAME_HDR_LEN], ERR_OK );
+
+      ChanCmdDone( info, op, &buff[FRAME_HDR_LEN], rsp );
+   }
+
+   // The flags byte is where the checksum goes in version 1,
+   // it's not used by this framing.
+   buff[FRAME_HDR_LEN+1] = 0;
+
+   rsp += FRAME_HDR_LEN;
+   u32_2_u8( CalcCRC32( buff, rsp ), &buff[rsp] );
+
+   StartRsp( info, buff, rsp + FRAME_CRC_LEN );
+}
+
+// COBS encode the response frame directly into the free space of
+// the transport's transmit buffer.
+// Returns non-zero once the whole frame has been sent.
+static int SendFrame( SerCmdInfo *info )
+{
+   uint8_t *out;
+   int ct;
+
+   while( (ct = TxSpan( info, &out )) > 0 )
+   {
+      int n = 0;
+
+      while( n < ct )
+      {
+         if( info->flag & FLG_TX_END )
+         {
+            out[n++] = 0;
+            TxDone( info, n );
+            return 1;
+         }
+
+         // Start a new block.  The code byte is one more then
+         // the number of non-zero bytes that follow it.
+         if( !(info->flag & FLG_TX_BLK) )
+         {
+            int run = 0;
+            while( (run < COBS_MAX_RUN) && (info->rspNdx+run < info->rspLen) && FrameByte( info, info->rspNdx+run ) )
+               run++;
+
+            out[n++] = run+1;
+            info->txBlk = run;
+            info->flag |= FLG_TX_BLK;
+            if( run < COBS_MAX_RUN )
+               info->flag |= FLG_TX_ZERO;
+            else
+               info->flag &= ~FLG_TX_ZERO;
+         }
+
+         int m = ct-n;
+         if( m > info->txBlk )
+            m = info->txBlk;
+
+         info->txBlk -= m;
+         while( m-- )
+            out[n++] = FrameByte( info, info->rspNdx++ );
+
+         if( info->txBlk )
+            continue;
+
+         // At the end of a block, either the frame is done or the
+         // next byte is the zero the block stands for (which isn't
+         // sent).  A full run doesn't stand for a zero, so if one is
+         // next it starts the following block.
+         info->flag &= ~FLG_TX_BLK;
+         if( info->rspNdx == info->rspLen )
+            info->flag |= FLG_TX_END;
+         else if( info->flag & FLG_TX_ZERO )
+            info->rspNdx++;
+      }
+
+      TxDone( info, n );
+   }
+   return 0;
+}
+
+// Set up to send a response held in a command buffer
+static void StartRsp( SerCmdInfo *info, const uint8_t *rsp, int len )
+{
+   info->src    = rsp;
+   info->srcLen = len;
+   info->hdrLen = 0;
+   info->rspNdx = 0;
+   info->rspLen = len;
+   info->txBlk  = 0;
+   info->flag  &= ~(FLG_TX_ESC | FLG_TX_BLK | FLG_TX_END);
+}
+
+// A few commands change what the channel does once their response
+// has been sent.  This is called with the response to each command
+// and picks up the details from the successful ones.
+static void ChanCmdDone( SerCmdInfo *info, int op, uint8_t *rsp, int len )
+{
+   if( (len < 2) || (rsp[0] != ERR_OK) )
+      return;
+
+   switch( op )
+   {
+      case CMD_SET_PROTO:
+         if( len >= 3 )
+            info->newProto = rsp[2];
+         break;
+
+      case CMD_READ_BULK:
+         if( len >= 10 )
+         {
+            info->bulkAddr = b2u32( &rsp[2] );
+            info->bulkLen  = b2u32( &rsp[6] );
+            info->bulkCRC  = CRC32_INIT;
+            info->flag |= FLG_BULK;
+         }
+         break;
+   }
+}
+
+// Set up the next frame of a bulk read.
+// Returns non-zero if there's another frame to send, or
+// zero if there's no bulk read in progress or it's finished.
+static int NextBulkFrame( SerCmdInfo *info )
+{
+   if( !(info->flag & FLG_BULK) )
+      return 0;
+
+   uint8_t *frm = info->frm;
+   const uint8_t *src = (const uint8_t *)info->bulkAddr;
+   int hdr = (info->proto == 2) ? FRAME_HDR_LEN+2 : 2;
+   int ct = SERCMD_BULK_CHUNK;
+
+   if( ct > info->bulkLen )
+      ct = info->bulkLen;
+
+   // Once all the data has been sent, one more frame
+   // holds the CRC of all of it.
+   if( !ct )
+   {
+      if( info->flag & FLG_BULK_CRC )
+      {
+         info->flag &= ~(FLG_BULK | FLG_BULK_CRC);
+         return 0;
+      }
+
+      info->flag |= FLG_BULK_CRC;
+      u32_2_u8( info->bulkCRC, &frm[hdr] );
+      hdr += 4;
+   }
+   else
+   {
+      info->bulkCRC = UpdateCRC32( info->bulkCRC, src, ct );
+      info->bulkAddr += ct;
+      info->bulkLen  -= ct;
+   }
+
+   StartRsp( info, src, ct );
+   info->hdrLen = hdr;
+   info->rspLen = hdr + ct;
+
+   // The frame header is the same as for a successful response
+   if( info->proto == 2 )
+   {
+      frm[0] = info->buff[ info->txSlot ][0];
+      frm[1] = ERR_OK;
+      frm[2] = 0;
+
+      u32_2_u8( UpdateCRC32( CalcCRC32( frm, hdr ), src, ct ), &frm[hdr] );
+      info->rspLen += FRAME_CRC_LEN;
+   }
+   else
+   {
+      uint8_t cksum = 0x55;
+      for( int i=2; i<hdr; i++ )
+         cksum ^= frm[i];
+      for( int i=0; i<ct; i++ )
+         cksum ^= src[i];
+
+      frm[0] = ERR_OK;
+      frm[1] = cksum;
+   }
+
+   return 1;
+}
@@ -1,5 +1,7 @@
 /* sprintf.c */
 
+// SPRINTF_TEST leaves out the standard function names so this can be
+// built on a host next to the C library.  See test/sprintf_test.c
 //#define SPRINTF_TEST
 
 #include <math.h>
@@ -7,6 +9,7 @@
 #include <stddef.h>
 #include <stdint.h>
 #include <string.h>
+#include "sprintf.h"
 #include "utils.h"
 
 #define FLG_ALT_FORM     0x00000001      // Alternate form flag
@@ -34,34 +37,87 @@ typedef struct
 static const char *ParseFieldFlags( FieldInfo *info, const char *fmt );
 static const char *ParseLengthModifier( FieldInfo *info, const char *fmt );
 static const char *ParseNextInt( int *iptr, const char *fmt, int dflt );
-static int FormatInt( FieldInfo *info, long val, char *str, int max );
-static int FormatLong( FieldInfo *info, long long val, char *str, int max );
-static int FormatFloat( FieldInfo *info, float val, char *str, int max );
-static int FormatExp( FieldInfo *info, float val, char *str, int max );
-//static int FormatG( FieldInfo *info, float val, char *str, int max );
-static int FormatBad( FieldInfo *info, const char *fmt, char *str, int max );
-static int FormatStr( FieldInfo *info, char *str, const char *src, int max );
+static void FormatInt( FieldInfo *info, long val, PrintSink *out );
+static void FormatLong( FieldInfo *info, long long val, PrintSink *out );
+static void FormatFloat( FieldInfo *info, float val, PrintSink *out );
+static void FormatExp( FieldInfo *info, float val, PrintSink *out );
+//static void FormatG( FieldInfo *info, float val, PrintSink *out );
+static void FormatBad( FieldInfo *info, const char *fmt, PrintSink *out );
+static void PadField( FieldInfo *info, char signChar, const char *val, int L, PrintSink *out );
+static void FormatStr( FieldInfo *info, const char *src, PrintSink *out );
+
+// Set up a sink that writes to one or two spans.  Pass a null
+// pointer for the second span if there's only one.
+void SinkInit( PrintSink *out, void *p1, int n1, void *p2, int n2 )
+{
+   out->ptr[0] = p1;
+   out->room[0] = n1;
+   out->ptr[1] = p2;
+   out->room[1] = p2 ? n2 : 0;
+   out->ndx = 0;
+   out->len = 0;
+}
 
-// This returns the number of characters that WOULD have been written if the string was long enough.
-int MYvsnprintf( char *str, size_t size, const char *format, va_list ap )
+// Add characters to a sink.  The length is counted even
+// when there's no room left for them.
+static void SinkWrite( PrintSink *out, const char *src, int n )
+{
+   out->len += n;
+   while( (n > 0) && (out->ndx < 2) )
+   {
+      int ct = out->room[ out->ndx ];
+      if( ct > n ) ct = n;
+
+      memcpy( out->ptr[ out->ndx ], src, ct );
+      out->ptr[ out->ndx ] += ct;
+      out->room[ out->ndx ] -= ct;
+      src += ct;
+      n -= ct;
+
+      if( !out->room[ out->ndx ] )
+         out->ndx++;
+   }
+}
+
+// Add n copies of a padding character to a sink
+static void SinkPad( PrintSink *out, char pad, int n )
 {
-   int zeroSize = !size;
-   if( !zeroSize ) size--;
+   if( n <= 0 )
+      return;
+
+   out->len += n;
+   while( (n > 0) && (out->ndx < 2) )
+   {
+      int ct = out->room[ out->ndx ];
+      if( ct > n ) ct = n;
+
+      memset( out->ptr[ out->ndx ], pad, ct );
+      out->ptr[ out->ndx ] += ct;
+      out->room[ out->ndx ] -= ct;
+      n -= ct;
+
+      if( !out->room[ out->ndx ] )
+         out->ndx++;
+   }
+}
 
-   int ret = 0;
+// Format into a sink.  Returns the total number of characters
+// produced, including any that didn't fit.
+int SinkPrintf( PrintSink *out, const char *format, va_list ap )
+{
    while( *format )
    {
-      char ch = *format++;
-      if( ch != '%' )
+      // Copy everything up to the next field in one go
+      const char *lit = format;
+      while( *format && (*format != '%') )
+         format++;
+
+      if( format != lit )
       {
-         ret++;
-         if( size > 0 )
-         {
-            *str++ = ch;
-            size--;
-         }
+         SinkWrite( out, lit, format-lit );
          continue;
       }
+      format++;
 
       // The first field after % is the flags field
       FieldInfo finfo;
@@ -100,7 +156,6 @@ int MYvsnprintf( char *str, size_t size, const char *format, va_list ap )
       finfo.spec = *format;
       if( *format ) format++;
 
-      size_t len = 0;
       switch( finfo.spec )
       {
          case 'u': case 'x': case 'X':
@@ -111,7 +166,7 @@ int MYvsnprintf( char *str, size_t size, const char *format, va_list ap )
             if( finfo.flags & FLG_LEN_LLONG )
             {
                long long int ll = va_arg( ap, long long int );
-               len = FormatLong( &finfo, ll, str, size );
+               FormatLong( &finfo, ll, out );
                break;
             }
             long val;
@@ -119,14 +174,14 @@ int MYvsnprintf( char *str, size_t size, const char *format, va_list ap )
                val = va_arg( ap, long );
             else
                val = va_arg( ap, int );
-            len = FormatInt( &finfo, val, str, size );
+            FormatInt( &finfo, val, out );
             break;
 
          case 'p': // pointer
          {
             void *ptr = va_arg( ap, void* );
             finfo.flags |= FLG_UNSIGNED;
-            len = FormatInt( &finfo, (uint32_t)ptr, str, size );
+            FormatInt( &finfo, (uint32_t)ptr, out );
             break;
          }
 
@@ -134,7 +189,7 @@ int MYvsnprintf( char *str, size_t size, const char *format, va_list ap )
          {
             uint32_t tmp = va_arg( ap, uint32_t );
             float val = I2F(tmp);
-            len = FormatFloat( &finfo, val, str, size );
+            FormatFloat( &finfo, val, out );
             break;
          }
 
@@ -142,52 +197,52 @@ int MYvsnprintf( char *str, size_t size, const char *format, va_list ap )
          {
             uint32_t tmp = va_arg( ap, uint32_t );
             float val = I2F(tmp);
-            len = FormatExp( &finfo, val, str, size );
+            FormatExp( &finfo, val, out );
             break;
          }
          
          case 's':
          {
             const char *src = va_arg( ap, const char * );
-            len = FormatStr( &finfo, str, src, size );
+            FormatStr( &finfo, src, out );
             break;
          }
 
          case 'c':
          {
             char ch = va_arg( ap, int );
-            len = 1;
-            if( size ) *str = ch;
+            SinkWrite( out, &ch, 1 );
             break;
          }
 
          case '%':
-            len = 1;
-            if( size ) *str = '%';
+            SinkWrite( out, "%", 1 );
             break;
 
          default:
-            len = FormatBad( &finfo, format, str, size );
+            FormatBad( &finfo, format, out );
             break;
       }
-      ret += len;
-
-      if( len <= size )
-      {
-         size -= len;
-         str += len;
-      }
-      else
-      {
-         str += size;
-         size = 0;
-      }
    }
 
+   return out->len;
+}
+
+// This returns the number of characters that WOULD have been written if the string was long enough.
+int MYvsnprintf( char *str, size_t size, const char *format, va_list ap )
+{
+   if( size > 0x7fffffff )
+      size = 0x7fffffff;
+
+   PrintSink out;
+   SinkInit( &out, str, size ? size-1 : 0, 0, 0 );
+
+   int ret = SinkPrintf( &out, format, ap );
+
    // Add a terminating null character to the string as long
    // as the size passed in wasn't zero
-   if( !zeroSize )
-      *str = 0;
+   if( size )
+      *out.ptr[0] = 0;
 
    return ret;
 }
@@ -215,6 +270,29 @@ int snprintf(char *str, size_t size, const char *format, ...)
    va_end(ap);
    return ret;
 }
+
+// Format directly into the free space of a circular buffer, with no
+// intermediate copy.  The text is only added to the buffer if all of
+// it fits, so a reader never sees a partial line.  Returns the number
+// of characters added, or -1 if there wasn't room.
+//
+// Don't use this on a buffer that's carrying the binary command
+// protocol, since the text would end up between its frames.
+int BuffPrintf( CircBuff *cb, const char *format, va_list ap )
+{
+   BuffSpan span[2];
+   int room = BuffAddSpans( cb, span );
+
+   PrintSink out;
+   SinkInit( &out, span[0].ptr, span[0].len, span[1].ptr, span[1].len );
+
+   int len = SinkPrintf( &out, format, ap );
+   if( len > room )
+      return -1;
+
+   BuffAddDone( cb, len );
+   return len;
+}
 #endif
 
 // Parse the flags portion of the field
@@ -297,16 +375,8 @@ static const char *ParseNextInt( int *iptr, const char *fmt, int dflt )
    return fmt;
 }
 
-// Add ct padding chacters to the string, Returns the number actually added
-static int AddPadding( char *str, char pad, int ct, int max )
-{
-   if( max < ct ) ct = max;
-   for( int i=0; i<ct; i++ ) *str++ = pad;
-   return ct;
-}
-
-// Format the integer into *str and return the length.
-static int FormatInt( FieldInfo *info, long val, char *str, int max )
+// Format an integer value
+static void FormatInt( FieldInfo *info, long val, PrintSink *out )
 {
    unsigned long uval;
    int neg = 0;
@@ -386,227 +456,434 @@ static int FormatInt( FieldInfo *info, long val, char *str, int max )
    else if( info->flags & FLG_ADD_BLANK )
       signChar = ' ';
 
-   // See how many padding characters I need to add
-   int ct, L = strlen(bptr);
-   int ret = 0;
+   PadField( info, signChar, bptr, strlen(bptr), out );
+}
 
+// Write a formatted value with its sign and padding to fill the
+// field width.
+static void PadField( FieldInfo *info, char signChar, const char *val, int L, PrintSink *out )
+{
+   // See how many padding characters I need to add
    int pct = info->width - L;
    if( signChar ) pct--;
-   if( pct < 0 ) pct = 0;
 
    // If we're left adjusting or zero padding, the sign character goes first
    if( (info->flags & (FLG_LEFT_ADJ|FLG_ZERO_PAD)) && signChar )
    {
-      if( max )
-      {
-         *str++ = signChar;
-         max--;
-      }
-      ret++;
+      SinkWrite( out, &signChar, 1 );
       signChar = 0;
    }
 
    // If we aren't left adjusting, the padding goes next
    if( !(info->flags & FLG_LEFT_ADJ) )
    {
-      char pad = (info->flags & FLG_ZERO_PAD) ? '0' : ' ';
-      ct = AddPadding( str, pad, pct, max );
-      max -= ct;
-      str += ct;
-      ret += pct;
+      SinkPad( out, (info->flags & FLG_ZERO_PAD) ? '0' : ' ', pct );
       pct = 0;
    }
 
    // Add the sign character if there's still one to add
    if( signChar )
-   {
-      if( max )
-      {
-         *str++ = signChar;
-         max--;
-      }
-      ret++;
-   }
+      SinkWrite( out, &signChar, 1 );
 
    // The value string goes next
-   ct = (L<max) ? L : max;
-   strncpy( str, bptr, ct );
-   str += ct;
-   max -= ct;
-   ret += L;
+   SinkWrite( out, val, L );
 
    // If there's still padding, add that now.  This would always be a space
-   if( pct )
+   SinkPad( out, ' ', pct );
+}
+
+// FIXME - need to add support for this
+static void FormatLong( FieldInfo *info, long long val, PrintSink *out )
+{
+   FormatInt( info, (long )val, out );
+}
+
+// Floats are formatted exactly, rounding to nearest with ties to even
+// like the C library.  Every float is a 24-bit integer times a power
+// of 2 between 2^-149 and 2^104, so this can be done with integer math
+// instead of repeatedly multiplying and subtracting floats.
+//
+// The common case of a value below 2^32 with up to 9 digits after the
+// point is done by scaling the fraction once to a 64-bit integer.  The
+// digits are then found by dividing 32-bit values by 10, which the
+// compiler turns into a multiply by the reciprocal.  Everything else
+// (huge values, more digits, and %e) uses a slower exact expansion.
+
+// Largest number of digits produced by the exact expansion.  Larger
+// precisions are padded with zeros, which is right for any value that
+// isn't tiny.
+#define MAX_FLOAT_DIGITS  100
+
+// Bits in the fractional part of the exact expansion
+#define FRAC_BITS         149
+#define FRAC_WORDS        5
+
+static const uint32_t pow10[] =
+{
+   1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+};
+
+// Exact decimal expansion of a float, made one digit at a time
+typedef struct
+{
+   char ipart[ 40 ];              // Integer part digits.  The max float is 3.4e38
+   int ict;                       // Number of integer digits, at least 1
+   int ndx;                       // Next digit to return
+   uint32_t frac[ FRAC_WORDS ];   // Remaining fraction times 2^149
+} FloatDec;
+
+// Split a float into a mantissa and a power of 2, and return the sign
+static int SplitFloat( float val, uint32_t *mant, int *exp )
+{
+   uint32_t bits = F2I( val );
+   int e = (bits >> 23) & 0xFF;
+
+   *mant = bits & 0x007FFFFF;
+   if( e )
    {
-      ct = AddPadding( str, ' ', pct, max );
-      max -= ct;
-      str += ct;
-      ret += pct;
+      *mant |= 0x00800000;
+      *exp = e - 150;
    }
+   else
+      *exp = -149;
 
-   return ret;
+   return bits >> 31;
 }
 
-// FIXME - need to add support for this
-static int FormatLong( FieldInfo *info, long long val, char *str, int max )
+// Write the digits of a 32-bit value ending at end.
+// At least min digits are written.  Returns a pointer to the first one.
+static char *U32toDec( uint32_t val, char *end, int min )
 {
-   return FormatInt( info, (long )val, str, max );
+   while( val || (min > 0) )
+   {
+      *--end = '0' + val % 10;
+      val /= 10;
+      min--;
+   }
+   return end;
 }
 
-static int FormatFloat( FieldInfo *info, float val, char *str, int max )
+// Start the exact expansion of mant * 2^exp
+static void FloatDecInit( FloatDec *fd, uint32_t mant, int exp )
 {
-   // Check for outliers
-   const char *bad = 0;
-   if( isnanf( val ) ) bad = (val<0) ? "-nan" : "nan";
-   if( isinff( val ) ) bad = (val<0) ? "-inf" : "inf";
-   if( bad )
+   memset( fd, 0, sizeof(*fd) );
+
+   // Find the integer part.  Up to 128 bits are needed, which are
+   // converted 9 digits at a time by long division with 10^9.
+   uint32_t ip[4] = { 0, 0, 0, 0 };
+   if( exp >= 0 )
    {
-      for( int i=0; i<max && bad[i]; i++ )
-         *str++ = bad[i];
-      return strlen(bad);
+      int w = exp >> 5, b = exp & 31;
+      ip[w] = mant << b;
+      if( b && (w < 3) )
+         ip[w+1] = mant >> (32-b);
    }
+   else if( exp > -32 )
+      ip[0] = mant >> -exp;
 
-   // If precision wasn't specified, default to 6
-   if( info->prec < 0 ) info->prec = 6;
+   char buff[ 45 ];
+   char *end = &buff[45];
+   char *ptr = end;
+   int top = 3;
+   while( 1 )
+   {
+      while( (top > 0) && !ip[top] ) top--;
+      if( !top && (ip[0] < 1000000000) )
+      {
+         ptr = U32toDec( ip[0], ptr, (ptr == end) ? 1 : 0 );
+         break;
+      }
 
-   // Convert to a positive number for simplicity
-   int neg = (val<0);
-   val = fabsf(val);
+      uint64_t rem = 0;
+      for( int i=top; i>=0; i-- )
+      {
+         uint64_t x = (rem << 32) | ip[i];
+         ip[i] = x / 1000000000;
+         rem = x % 1000000000;
+      }
+      ptr = U32toDec( rem, ptr, 9 );
+   }
 
-   // Round off based on precision
-   // This static array is to make this faster for likely precisions
-   static float _round[] = { 5e-1f, 5e-2f, 5e-3f, 5e-4f, 5e-5f, 5e-6f, 5e-7f, 5e-8f, 5e-9f, 5e-10f };
-   if( info->prec < (int)(sizeof(_round)/sizeof(float)) )
-      val += _round[info->prec];
-   else
-      val += 0.5 * powf( 10, -info->prec );
-
-   // I'll store the value to the left of the decimal point here
-   // The max 32-bit float is 3.4e38, so 40 bytes should do it.
-   char left[50];
-   char *lptr = &left[50];
-   *--lptr = 0;
-
-   // Split the value into an integer and fractional part.
-   // If the value is too large to fit in a 32-bit integer, then the fraction can be considered
-   // zero since there isn't enough resolution to handle it anyway.
-   int big = 0;
-   while( val >= 4294967296.0f )
+   fd->ict = end - ptr;
+   memcpy( fd->ipart, ptr, fd->ict );
+
+   // The fractional bits are placed so that bit 149 is the units
+   if( exp < 0 )
    {
-      big++;
-      *--lptr = '0';
-      val *= 0.1;
+      int sh = -exp;
+      uint32_t f = (sh < 32) ? (mant & ((1u << sh) - 1)) : mant;
+      int pos = FRAC_BITS - sh;
+      int w = pos >> 5, b = pos & 31;
+      fd->frac[w] = f << b;
+      if( b && (w < FRAC_WORDS-1) )
+         fd->frac[w+1] = f >> (32-b);
    }
+}
 
-   uint32_t ipart = (uint32_t)val;
-   if( big )
-      val = 0;
-   else
-      val -= ipart;
+// Return the next digit of the expansion, integer digits first
+static int FloatDecNext( FloatDec *fd )
+{
+   if( fd->ndx < fd->ict )
+      return fd->ipart[ fd->ndx++ ] - '0';
 
-   if( !ipart )
-      *--lptr = '0';
-   else
+   uint32_t carry = 0;
+   for( int i=0; i<FRAC_WORDS; i++ )
    {
-      while( ipart )
+      uint64_t x = (uint64_t)fd->frac[i] * 10 + carry;
+      fd->frac[i] = x;
+      carry = x >> 32;
+   }
+
+   // Bit 149 is bit 21 of the top word
+   int d = fd->frac[FRAC_WORDS-1] >> 21;
+   fd->frac[FRAC_WORDS-1] &= 0x001FFFFF;
+   return d;
+}
+
+// Returns true if there are no more non-zero digits
+static int FloatDecDone( FloatDec *fd )
+{
+   for( int i=fd->ndx; i<fd->ict; i++ )
+      if( fd->ipart[i] != '0' ) return 0;
+
+   for( int i=0; i<FRAC_WORDS; i++ )
+      if( fd->frac[i] ) return 0;
+
+   return 1;
+}
+
+// Round a string of ct digits based on the digits that follow.
+// Returns 1 if it carried out of the first digit, in which case
+// the digits are all zero.
+static int RoundDigits( FloatDec *fd, char *dig, int ct )
+{
+   int next = FloatDecNext( fd );
+   if( next < 5 )
+      return 0;
+
+   // A tie rounds to an even digit
+   if( (next == 5) && FloatDecDone( fd ) && !(ct && ((dig[ct-1] - '0') & 1)) )
+      return 0;
+
+   for( int i=ct-1; i>=0; i-- )
+   {
+      if( dig[i] != '9' )
       {
-         *--lptr = '0' + ipart % 10;
-         ipart /= 10;
+         dig[i]++;
+         return 0;
       }
+      dig[i] = '0';
    }
+   return 1;
+}
 
-   // Add the sign if needed
+// Find the sign character for a float
+static char FloatSign( FieldInfo *info, int neg )
+{
    if( neg )
-      *--lptr = '-';
+      return '-';
    else if( info->flags & FLG_ADD_SIGN )
-      *--lptr = '+';
+      return '+';
    else if( info->flags & FLG_ADD_BLANK )
-      *--lptr = ' ';
-
-   // Copy all we can into the output string
-   int len = strlen(lptr);
-   int ct = (len<max) ? len : max;
-   memcpy( str, lptr, ct );
-   str += ct;
-   max -= ct;
-
-   // Add a decial point if precision wasn't zero or if the alternate form was requested
-   // For floats, alternate form means always add a decimal
-   if( info->prec || (info->flags & FLG_ALT_FORM) )
+      return ' ';
+   return 0;
+}
+
+// Check for values that aren't numbers, and write them out if
+// found.  Returns 1 if the value was written or 0 if not.
+static int FormatNan( FieldInfo *info, float val, PrintSink *out )
+{
+   const char *bad;
+   if( isnanf( val ) )
+      bad = (info->spec & 0x20) ? "nan" : "NAN";
+   else if( isinff( val ) )
+      bad = (info->spec & 0x20) ? "inf" : "INF";
+   else
+      return 0;
+
+   info->flags &= ~FLG_ZERO_PAD;
+   PadField( info, FloatSign( info, F2I(val) >> 31 ), bad, 3, out );
+   return 1;
+}
+
+static void FormatFloat( FieldInfo *info, float val, PrintSink *out )
+{
+   if( FormatNan( info, val, out ) )
+      return;
+
+   // If precision wasn't specified, default to 6
+   int prec = info->prec;
+   if( prec < 0 ) prec = 6;
+
+   uint32_t mant;
+   int exp;
+   int neg = SplitFloat( val, &mant, &exp );
+
+   // The value goes here, built up from the end
+   char buff[ 45 + MAX_FLOAT_DIGITS ];
+   char *end = &buff[ sizeof(buff) ];
+   char *ptr;
+
+   if( (exp <= 8) && (prec < (int)ARRAY_CT(pow10)) )
    {
-      len++;
-      if( max )
+      uint32_t ipart = 0, rem = mant;
+      if( exp >= 0 )
       {
-         *str++ = '.';
-         max--;
+         ipart = mant << exp;
+         rem = 0;
+      }
+      else if( exp > -32 )
+      {
+         ipart = mant >> -exp;
+         rem = mant & ((1u << -exp) - 1);
+      }
+
+      // Scale the fraction by 10^prec and round it.  The fraction is
+      // rem / 2^sh, and rem * 10^prec is less than 2^54 so anything
+      // shifted further than that is less than half.
+      int sh = -exp;
+      uint32_t q = 0;
+      if( (sh > 0) && (sh < 55) )
+      {
+         uint64_t F = (uint64_t)rem * pow10[prec];
+         q = F >> sh;
+
+         uint64_t r = F & ((1ull << sh) - 1);
+         uint64_t half = 1ull << (sh-1);
+         uint32_t last = prec ? q : ipart;
+         if( (r > half) || ((r == half) && (last & 1)) )
+         {
+            if( ++q == pow10[prec] )
+            {
+               q = 0;
+               ipart++;
+            }
+         }
       }
-   }
 
-   // Add value as specified by precision
-   while( info->prec )
+      ptr = end;
+      if( prec )
+      {
+         ptr = U32toDec( q, ptr, prec );
+         *--ptr = '.';
+      }
+      else if( info->flags & FLG_ALT_FORM )
+         *--ptr = '.';
+      ptr = U32toDec( ipart, ptr, 1 );
+   }
+   else
    {
-      val *= 10;
-      int x = val;
-      val -= x;
-      len++;
-      info->prec--;
+      // Exact expansion.  The integer digits come first, then
+      // enough fraction digits for the precision.
+      FloatDec fd;
+      FloatDecInit( &fd, mant, exp );
+
+      int fct = (prec < MAX_FLOAT_DIGITS) ? prec : MAX_FLOAT_DIGITS;
+      ptr = &buff[1];
+      int ct = fd.ict + fct;
+      for( int i=0; i<ct; i++ )
+         ptr[i] = '0' + FloatDecNext( &fd );
+
+      if( RoundDigits( &fd, ptr, ct ) )
+      {
+         *--ptr = '1';
+         ct++;
+      }
+
+      // Move the fraction over to make room for the point
+      char *point = &ptr[ ct - fct ];
+      memmove( point+1, point, fct );
+      int L = ct - fct;
+      if( prec || (info->flags & FLG_ALT_FORM) )
+      {
+         *point = '.';
+         L++;
+      }
+      L += fct;
 
-      if( max )
+      // Pad out very large precisions
+      while( fct < prec )
       {
-         *str++ = (char)('0' + x);
-         max--;
+         if( &ptr[L] >= end ) break;
+         ptr[L++] = '0';
+         fct++;
       }
+      end = &ptr[L];
    }
-   return len;
+
+   PadField( info, FloatSign( info, neg ), ptr, end-ptr, out );
 }
 
-static int FormatExp( FieldInfo *info, float val, char *str, int max )
+static void FormatExp( FieldInfo *info, float val, PrintSink *out )
 {
-   int exp = 0;
-   float av = fabsf(val);
-
-   if( av )
+   if( FormatNan( info, val, out ) )
+      return;
+
+   int prec = info->prec;
+   if( prec < 0 ) prec = 6;
+   if( prec > MAX_FLOAT_DIGITS ) prec = MAX_FLOAT_DIGITS;
+
+   uint32_t mant;
+   int exp;
+   int neg = SplitFloat( val, &mant, &exp );
+
+   FloatDec fd;
+   FloatDecInit( &fd, mant, exp );
+
+   // Skip leading zeros to find the first significant digit
+   // and the decimal exponent.
+   char dig[ MAX_FLOAT_DIGITS+1 ];
+   int dexp = fd.ict - 1;
+   int d = FloatDecNext( &fd );
+   if( mant )
    {
-      exp = (int)floorf(log10f(av));
-      val *= powf( 10, -exp );
+      while( !d )
+      {
+         dexp--;
+         d = FloatDecNext( &fd );
+      }
    }
+   else
+      dexp = 0;
 
-   int len = FormatFloat( info, val, str, max );
-   max -= len;
-   str += len;
+   dig[0] = '0' + d;
+   for( int i=1; i<=prec; i++ )
+      dig[i] = '0' + FloatDecNext( &fd );
 
-   if( max > 0 )
+   if( RoundDigits( &fd, dig, prec+1 ) )
    {
-      *str++ = 'e';
-      max--;
-      len++;
+      dig[0] = '1';
+      dexp++;
    }
 
-   if( max < 0 )
-      max = 0;
-
-   FieldInfo fi;
-   fi.flags = FLG_ZERO_PAD | FLG_ADD_SIGN;
-   fi.width = 3;
-   fi.spec = 'd';
-   fi.start = "%02d";
-
-   len += FormatInt( &fi, exp, str, max );
-
-   return len;
+   // Build the string: d.ddde+xx
+   char buff[ MAX_FLOAT_DIGITS+10 ];
+   int L = 0;
+   buff[L++] = dig[0];
+   if( prec || (info->flags & FLG_ALT_FORM) )
+      buff[L++] = '.';
+   memcpy( &buff[L], &dig[1], prec );
+   L += prec;
+
+   buff[L++] = (info->spec == 'E') ? 'E' : 'e';
+   buff[L++] = (dexp < 0) ? '-' : '+';
+   if( dexp < 0 ) dexp = -dexp;
+
+   char ebuff[4];
+   char *eptr = U32toDec( dexp, &ebuff[4], 2 );
+   int ect = &ebuff[4] - eptr;
+   memcpy( &buff[L], eptr, ect );
+   L += ect;
+
+   PadField( info, FloatSign( info, neg ), buff, L, out );
 }
 
-static int FormatBad( FieldInfo *info, const char *fmt, char *str, int max )
+static void FormatBad( FieldInfo *info, const char *fmt, PrintSink *out )
 {
-   int len = fmt - info->start;
-   int ct = (len>max) ? max : len;
-
-   for( int i=0; i<ct; i++ )
-      *str++ = *info->start++;
-   return len;
+   SinkWrite( out, info->start, fmt - info->start );
 }
 
-static int FormatStr( FieldInfo *info, char *str, const char *src, int max )
+static void FormatStr( FieldInfo *info, const char *src, PrintSink *out )
 {
    int L = MYstrlen( src );
 
@@ -622,25 +899,13 @@ static int FormatStr( FieldInfo *info, char *str, const char *src, int max )
    if( pad < 0 ) pad = 0;
 
    // Add blanks to left of string
-   if( pad && !(info->flags & FLG_LEFT_ADJ) )
-   {
-      int ct = (pad<max) ? pad : max;
-      for( int i=0; i<ct; i++ ) *str++ = ' ';
-   }
-
-   // Add string
-   int ct = (L<max) ? L : max;
-   for( int i=0; i<ct; i++ ) *str++ = *src++;
-   max -= ct;
-
-   if( !pad ) return L;
-
-   // Add trailing padding
-   if( info->flags & FLG_LEFT_ADJ )
+   if( !(info->flags & FLG_LEFT_ADJ) )
    {
-      int ct = (pad<max) ? pad : max;
-      for( int i=0; i<ct; i++ ) *str++ = ' ';
+      SinkPad( out, ' ', pad );
+      pad = 0;
    }
 
-   return info->width;
+   // Add string and any trailing padding
+   SinkWrite( out, src, L );
+   SinkPad( out, ' ', pad );
 }
@@ -1,46 +1,89 @@
 /* store.c */
 
 #include "cpu.h"
+#include "crc.h"
 #include "errors.h"
 #include "flash.h"
 #include "store.h"
 #include "string.h"
 #include "trace.h"
 
-// This module handles non-volatile parameter storage 
+// This module handles non-volatile parameter storage
 //
-// These parameters are stored in a structure of fixed size
-// in two pages of flash memory.
+// The parameters live in a StoreData structure which is kept in RAM.
+// Flash holds a log of changes to that structure rather than copies of
+// the whole thing.
 //
-// On system startup we look through these two pages of flash to find the
-// valid parameters.  There should only be one valid copy under normal conditions
-// If multiple copies are found (which could happen if we lose power during an 
-// update for example), then the most recently written copy will be kept.
+// The storage area is a ring of flash pages, only one of which is in
+// use at a time.  Each page starts with a header holding a sequence
+// number which goes up by one for every new page.  After the header
+// come records, each of which holds a range of bytes of the structure
+// along with a CRC.  Records are written into the erased space after
+// the last one, so changing a parameter only costs the bytes of that
+// parameter and the page is only erased once it's full.
 //
-// When a parameter value is changed, the function StoreUpdt is called to 
-// update the values in flash.  This function first writes a new copy of
-// the parameter structure to an erased area of flash, and once that copy 
-// is written and validated it overwrites part of the old copy to invalidate
-// it.  In this way there should always be at least one valid copy of the
-// parameters in flash memory and normally only one.
+// When a record doesn't fit in the current page, the next page in the
+// ring is erased and a single record holding the whole structure is
+// written to it.  The header is written last, so the new page isn't
+// used until it holds a full copy of the parameters and the old page
+// stays valid until then.  Since the pages are used in turn, the wear
+// is spread evenly over all of them.
+//
+// On system startup the page with the highest sequence number is found
+// and its records are replayed in order to rebuild the structure in RAM.
+// A record with a bad CRC would have been cut short by a loss of power.
+// Nothing after it can be trusted, so the parameters are compacted
+// into a new page.
 
 // Size of StoreData structure
 #define STORE_DATA_SIZE          0x00000100
 
-// Storage is in last two pages of flash
-#define STORE_ADDR               (FLASH_START+FLASH_SIZE-2*FLASH_PAGE_LEN)
+// Storage is in the last few pages of flash
+#define STORE_PAGES              4
+#define STORE_ADDR               (FLASH_START+FLASH_SIZE-STORE_PAGES*FLASH_PAGE_LEN)
+
+// Marks the start of a page in use.  Erased flash reads as all ones.
+#define PAGE_MAGIC               0x4B564C47
+
+// Largest record.  Records hold everything after the unused
+// header fields of the StoreData structure at most.
+#define DATA_START               8
+#define MAX_REC_DATA             (STORE_DATA_SIZE-DATA_START)
+
+// Records are padded to the 64-bit flash programming size
+#define REC_SIZE(len)            ((sizeof(RecHdr)+(len)+7) & ~7)
+
+// The old format kept copies of the whole structure in the last two
+// pages.  It's read once to bring the parameters over after an upgrade.
+#define OLD_STORE_ADDR           (FLASH_START+FLASH_SIZE-2*FLASH_PAGE_LEN)
+#define OLD_GOOD_MARK            0x55
+
+typedef struct
+{
+   uint32_t magic;               // PAGE_MAGIC once the page is in use
+   uint32_t seq;                 // One more than the page before it
+} PageHdr;
 
-// Value of mark in valid block.  Pretty arbitrary, anything but 0x00 or 0xff
-#define GOOD_MARK                0x55
+typedef struct
+{
+   uint8_t  off;                 // Offset of the data in StoreData
+   uint8_t  len;                 // Number of data bytes
+   uint16_t rsvd;                // Zero for now
+   uint32_t crc;                 // CRC of the first four header bytes and the data
+} RecHdr;
 
 // local functions
-static int CheckStruct( uint32_t addr );
-static uint32_t BlockCRC( void *blk );
-static void Invalidate( uint32_t addr );
-static int SaveBlock( StoreData *blk, uint32_t addr );
+static int ReplayPage( uint32_t page );
+static uint32_t RecordCRC( const RecHdr *hdr, const void *data );
+static int WriteRecord( uint32_t addr, int off, int len );
+static int Compact( void );
+static int LoadOldStore( void );
 
 // local data
-uint32_t storeAddr;
+static StoreData store;          // Current parameter values
+static uint32_t pageAddr;        // Page in use, or 0 if there isn't one
+static uint32_t pageSeq;         // Its sequence number
+static uint32_t writeAddr;       // Where the next record goes
 
 void StoreInit( void )
 {
@@ -56,166 +99,208 @@ void StoreInit( void )
       CheckSizeOfStoreData();
    }
 
-   // Total structures in two pages of flash
-   int N = 2 * FLASH_PAGE_LEN / STORE_DATA_SIZE;
-
-   // Run through structures looking for a valid one.
-   uint32_t addr = STORE_ADDR;
-   for( int i=0; i<N; i++, addr+=STORE_DATA_SIZE )
+   // Find the newest page in use.  The sequence numbers are compared
+   // as a signed difference so they can wrap.
+   for( int i=0; i<STORE_PAGES; i++ )
    {
-      // Check the structure at this address
-      if( !CheckStruct(addr) )
+      uint32_t page = STORE_ADDR + i*FLASH_PAGE_LEN;
+      const PageHdr *hdr = (const PageHdr *)page;
+      if( hdr->magic != PAGE_MAGIC )
          continue;
 
-      // If this is the first valid block we've found, 
-      // just keep track of the address
-      if( !storeAddr )
+      if( !pageAddr || ((int32_t)(hdr->seq - pageSeq) > 0) )
       {
-         storeAddr = addr;
-         continue;
+         pageAddr = page;
+         pageSeq = hdr->seq;
       }
-
-      // I've found multiple valid blocks.  This normally shouldn't
-      // happen but could if power is lost at just the right time
-      // when updating flash.
-      //
-      // I'll check the counter to see which was is newer and keep
-      // that address.  I'll also invalidate the older one.
-      StoreData *a = (StoreData *)storeAddr;
-      StoreData *b = (StoreData *)addr;
-
-      int8_t diff = b->count - a->count;
-      if( diff > 0 )
-      {
-         Invalidate( storeAddr );
-         storeAddr = addr;
-      }
-      else
-         Invalidate( addr );
    }
 
-   // If I found a valid parameter area, I'm done
-   if( storeAddr )
+   // Rebuild the parameters from its records.  If any are bad,
+   // or there's no page in use yet, start a new page.
+   memset( &store, 0, sizeof(store) );
+   if( pageAddr )
+   {
+      if( ReplayPage( pageAddr ) )
+         Compact();
       return;
+   }
 
-   // If no valid storage was found then I'll just create one with 
-   // zero values.
-   StoreData blank;
-   memset( &blank, 0, sizeof(blank) );
-   blank.mark = GOOD_MARK;
-   blank.crc = BlockCRC( &blank );
-
-   FlashErase( STORE_ADDR );
-   FlashWrite( STORE_ADDR, (uint32_t*)&blank, sizeof(blank)/sizeof(uint32_t) );
-   storeAddr = STORE_ADDR;
+   LoadOldStore();
+   Compact();
 }
 
 const StoreData *FindStore( void )
 {
-   return (const StoreData*)storeAddr;
+   return &store;
 }
 
 int StoreUpdtOff( uint32_t offset, const void *value, uint8_t len )
 {
-   // Make sure the passed pointer is pointing to somewhere
-   // in the current page and isn't in the reserved first 8 bytes
-   if( (offset < 8) || (offset >= STORE_DATA_SIZE) )
+   // Make sure the value is inside the structure
+   // and isn't in the unused first 8 bytes
+   if( (offset < DATA_START) || (offset + len > STORE_DATA_SIZE) )
       return ERR_RANGE;
 
-   // Copy the current parameter block to RAM
-   StoreData temp;
-   memcpy32( (uint32_t*)&temp, (uint32_t *)storeAddr, STORE_DATA_SIZE/4 );
+   // Nothing to write if the value hasn't changed
+   uint8_t *dest = (uint8_t*)&store + offset;
+   if( !memcmp( dest, value, len ) )
+      return 0;
 
-   // Update the contents in RAM
-   memcpy( (uint8_t*)&temp + offset, value, len );
-   memset( &temp.rsvd, 0, sizeof(temp.rsvd) );
+   memcpy( dest, value, len );
 
-   temp.count++;
-   temp.mark = GOOD_MARK;
-   temp.crc = BlockCRC( &temp );
+   // Add a record to the current page if it fits.  Otherwise, or if
+   // the write fails, the whole structure goes into the next page.
+   if( pageAddr && (writeAddr + REC_SIZE(len) <= pageAddr + FLASH_PAGE_LEN) )
+   {
+      if( !WriteRecord( writeAddr, offset, len ) )
+      {
+         writeAddr += REC_SIZE(len);
+         return 0;
+      }
+   }
 
-   uint32_t addr = storeAddr + STORE_DATA_SIZE;
+   return Compact();
+}
 
-   int err = SaveBlock( &temp, addr );
+// Apply the records in a page to the RAM copy of the parameters
+// and find where the next one goes.
+// Returns 0 if the page was clean or 1 if it ended in a bad record.
+static int ReplayPage( uint32_t page )
+{
+   uint32_t addr = page + sizeof(PageHdr);
+   uint32_t end = page + FLASH_PAGE_LEN;
 
-   // That shouldn't really fail, but if it does for some reason
-   // try storing in the first location of the other flash page.
-   // That will cause an erase first, so is more likely to succeed
-   if( err )
+   while( addr + sizeof(RecHdr) <= end )
    {
-      addr = STORE_ADDR;
-      if( storeAddr < STORE_ADDR + FLASH_PAGE_LEN )
-         addr += FLASH_PAGE_LEN;
-      err = SaveBlock( &temp, addr );
-   }
+      const RecHdr *hdr = (const RecHdr *)addr;
 
-   if( err ) return err;
+      // Erased flash marks the end of the log
+      const uint32_t *w = (const uint32_t *)addr;
+      if( (w[0] == 0xFFFFFFFF) && (w[1] == 0xFFFFFFFF) )
+         break;
+
+      if( (hdr->off < DATA_START) || (hdr->off + hdr->len > STORE_DATA_SIZE) ||
+          (addr + REC_SIZE(hdr->len) > end) )
+         return 1;
+
+      if( RecordCRC( hdr, hdr+1 ) != hdr->crc )
+         return 1;
 
-   // After successfully storing and validating the new parameters,
-   // Invalidate the old ones
-   Invalidate( storeAddr );
-   storeAddr = addr;
+      memcpy( (uint8_t*)&store + hdr->off, hdr+1, hdr->len );
+      addr += REC_SIZE(hdr->len);
+   }
 
+   writeAddr = addr;
    return 0;
 }
 
-static int SaveBlock( StoreData *blk, uint32_t addr )
+static uint32_t RecordCRC( const RecHdr *hdr, const void *data )
 {
-   // If the address is the start of a page, first erase the page
-   if( (addr & (FLASH_PAGE_LEN-1)) == 0 )
-   {
-      int err = FlashErase( addr );
-      if( err ) return err;
-   }
+   uint32_t crc = CalcCRC32( (const uint8_t*)hdr, 4 );
+   return UpdateCRC32( crc, (const uint8_t*)data, hdr->len );
+}
 
-   int err = FlashWrite( addr, (uint32_t*)blk, STORE_DATA_SIZE/4 );
+// Write a record holding len bytes of the parameters starting at off.
+// The record is read back to make sure it was written correctly.
+static int WriteRecord( uint32_t addr, int off, int len )
+{
+   uint32_t buff[ REC_SIZE(MAX_REC_DATA)/4 ];
+   RecHdr *hdr = (RecHdr *)buff;
+   int size = REC_SIZE(len);
+
+   // Unused bytes at the end are left erased
+   memset( buff, 0xFF, size );
+   hdr->off = off;
+   hdr->len = len;
+   hdr->rsvd = 0;
+   memcpy( hdr+1, (uint8_t*)&store + off, len );
+   hdr->crc = RecordCRC( hdr, hdr+1 );
+
+   int err = FlashWrite( addr, buff, size/4 );
    if( err ) return err;
 
-   if( memcmp32( (uint32_t*)addr, (uint32_t *)blk, STORE_DATA_SIZE/4 ) )
+   if( memcmp32( (uint32_t*)addr, buff, size/4 ) )
       return ERR_VERIFY;
 
    return 0;
 }
 
-// Check the block at this address o see if it's valid.
-// Returns 1 if it is, 0 if not
-static int CheckStruct( uint32_t addr )
+// Start the next page in the ring with a copy of all the parameters.
+// If that page can't be written, the ones after it are tried.
+static int Compact( void )
 {
-   StoreData *store = (StoreData *)addr;
-
-   // We set the mark to a fixed value if it's good. 
-   // That allows me to quickly identify bad blocks.
-   // If the block is erased, the mark will be 0xFF
-   // When I invalidate a block I set it to 0x00.
-   // The good mark could be any other value picked
-   // pretty much arbitrarily.
-   if( store->mark != GOOD_MARK )
+   uint32_t page = pageAddr ? pageAddr : STORE_ADDR + (STORE_PAGES-1)*FLASH_PAGE_LEN;
+   int err = ERR_FLASH;
+
+   for( int i=0; i<STORE_PAGES; i++ )
+   {
+      page += FLASH_PAGE_LEN;
+      if( page >= STORE_ADDR + STORE_PAGES*FLASH_PAGE_LEN )
+         page = STORE_ADDR;
+
+      // Don't erase the only good copy of the parameters
+      if( page == pageAddr )
+         break;
+
+      err = FlashErase( page );
+      if( err ) continue;
+
+      err = WriteRecord( page + sizeof(PageHdr), DATA_START, MAX_REC_DATA );
+      if( err ) continue;
+
+      // The page header goes in last
+      PageHdr hdr;
+      hdr.magic = PAGE_MAGIC;
+      hdr.seq = pageSeq + 1;
+      err = FlashWrite( page, (uint32_t*)&hdr, sizeof(hdr)/4 );
+      if( err ) continue;
+
+      if( memcmp32( (uint32_t*)page, (uint32_t*)&hdr, sizeof(hdr)/4 ) )
+      {
+         err = ERR_VERIFY;
+         continue;
+      }
+
+      pageAddr = page;
+      pageSeq = hdr.seq;
+      writeAddr = page + sizeof(PageHdr) + REC_SIZE(MAX_REC_DATA);
       return 0;
+   }
 
-   uint32_t crc = BlockCRC( store );
-   return store->crc == crc;
+   return err;
 }
 
-// Calculate the CRC of the block at this address
-// This chip happens to have a hardware CRC generator, so I'll use that.
-static uint32_t BlockCRC( void *blk )
+// Look for parameters saved in the old format, which was a copy of
+// the whole structure with a CRC.  The newest good copy is loaded.
+// Returns 1 if one was found.
+static int LoadOldStore( void )
 {
-   CRC_Regs *crc = (CRC_Regs *)CRC_BASE;
+   const StoreData *best = 0;
 
-   // Reset the CRC unit
-   crc->ctrl = 1;
+   for( uint32_t addr = OLD_STORE_ADDR; addr < FLASH_START+FLASH_SIZE; addr += STORE_DATA_SIZE )
+   {
+      const StoreData *old = (const StoreData *)addr;
+      if( old->mark != OLD_GOOD_MARK )
+         continue;
 
-   uint32_t *data = (uint32_t*)blk;
-   data++;
-   for( int i=0; i<(STORE_DATA_SIZE-4)/4; i++ )
-      crc->data = *data++;
-   return crc->data;
-}
+      // The old CRC was calculated by writing whole words to the
+      // CRC unit, so it has to be done the same way here.
+      CRC_Regs *crc = (CRC_Regs *)CRC_BASE;
+      crc->ctrl = 1;
 
-// Invalidate a block by zeroing out the first 64-bits
-// which includes the CRC and mark
-static void Invalidate( uint32_t addr )
-{
-   uint32_t zero[2] = {0,0};
-   FlashWrite( addr, zero, sizeof(zero) );
+      const uint32_t *data = (const uint32_t*)addr;
+      for( int i=1; i<STORE_DATA_SIZE/4; i++ )
+         crc->data = data[i];
+      if( crc->data != old->crc )
+         continue;
+
+      if( !best || ((int8_t)(old->count - best->count) > 0) )
+         best = old;
+   }
+
+   if( !best )
+      return 0;
+
+   memcpy( (uint8_t*)&store + DATA_START, (const uint8_t*)best + DATA_START, MAX_REC_DATA );
+   return 1;
 }
@@ -1,19 +1,117 @@
 #include <string.h>
 #include "utils.h"
 
-void *memset( void *s, int c, int sz )
+// The block functions below work a 32-bit word at a time once the
+// pointers are aligned.  Unaligned word accesses aren't allowed (the
+// code is built with -mno-unaligned-access), so only the head and
+// tail of each block are handled a byte at a time.  Blocks shorter
+// than WORD_MIN_LEN aren't worth the setup and just use bytes.
+#define WORD_MIN_LEN    12
+
+// Stop the compiler from turning the loops in these functions
+// back into calls to memset or memcpy, which would recurse.
+#define NO_LIBCALL      __attribute__(( optimize( "no-tree-loop-distribute-patterns" ) ))
+
+static inline int Misalign( const void *p )
+{
+   return (uintptr_t)p & 3;
+}
+
+NO_LIBCALL void *memset( void *s, int c, int sz )
 {
    uint8_t *ptr = (uint8_t*)s;
-   for( int i=0; i<sz; i++ )
+
+   if( sz >= WORD_MIN_LEN )
+   {
+      while( Misalign(ptr) )
+      {
+         *ptr++ = c;
+         sz--;
+      }
+
+      uint32_t w = (uint8_t)c * 0x01010101;
+      uint32_t *wptr = (uint32_t*)ptr;
+      for( ; sz >= 16; sz -= 16, wptr += 4 )
+      {
+         wptr[0] = w;
+         wptr[1] = w;
+         wptr[2] = w;
+         wptr[3] = w;
+      }
+      for( ; sz >= 4; sz -= 4 )
+         *wptr++ = w;
+      ptr = (uint8_t*)wptr;
+   }
+
+   while( sz-- > 0 )
       *ptr++ = c;
    return s;
 }
 
-void *memcpy( void *dest, const void *src, int n )
+// Copy whole words from an aligned source to an aligned destination.
+// Returns the number of bytes copied, which is a multiple of 4.
+static inline int CopyWords( uint32_t *dptr, const uint32_t *sptr, int n )
+{
+   int ct = n & ~3;
+   for( ; n >= 16; n -= 16, dptr += 4, sptr += 4 )
+   {
+      uint32_t a = sptr[0], b = sptr[1], c = sptr[2], d = sptr[3];
+      dptr[0] = a;
+      dptr[1] = b;
+      dptr[2] = c;
+      dptr[3] = d;
+   }
+   for( ; n >= 4; n -= 4 )
+      *dptr++ = *sptr++;
+   return ct;
+}
+
+// Copy whole words to an aligned destination from a source which isn't
+// aligned.  The source is read as aligned words which are shifted
+// together, which assumes little endian byte order.  The reads never
+// leave the words holding the source bytes, so they can't fault.
+// Returns the number of bytes copied.
+static inline int CopyShifted( uint32_t *dptr, const uint8_t *src, int n )
+{
+   int rs = 8 * Misalign(src);
+   int ls = 32 - rs;
+   const uint32_t *sptr = (const uint32_t*)(src - Misalign(src));
+
+   int ct = n & ~3;
+   uint32_t cur = *sptr++;
+   for( ; n >= 4; n -= 4 )
+   {
+      uint32_t next = *sptr++;
+      *dptr++ = (cur >> rs) | (next << ls);
+      cur = next;
+   }
+   return ct;
+}
+
+NO_LIBCALL void *memcpy( void *dest, const void *src, int n )
 {
    uint8_t *dptr = (uint8_t*)dest;
    const uint8_t *sptr = (uint8_t*)src;
-   for( int i=0; i<n; i++ )
+
+   if( n >= WORD_MIN_LEN )
+   {
+      while( Misalign(dptr) )
+      {
+         *dptr++ = *sptr++;
+         n--;
+      }
+
+      int ct;
+      if( Misalign(sptr) )
+         ct = CopyShifted( (uint32_t*)dptr, sptr, n );
+      else
+         ct = CopyWords( (uint32_t*)dptr, (const uint32_t*)sptr, n );
+      dptr += ct;
+      sptr += ct;
+      n -= ct;
+   }
+
+   while( n-- > 0 )
       *dptr++ = *sptr++;
    return dest;
 }
@@ -21,24 +119,51 @@ void *memcpy( void *dest, const void *src, int n )
 // Copys N 32-bit values
 void memcpy32( uint32_t *dest, uint32_t *src, int n )
 {
-   for( int i=0; i<n; i++ )
-      *dest++ = *src++;
+   CopyWords( dest, src, 4*n );
 }
 
 // Just like memcpy, but buffers can overlap
-void *memmove( void *dest, const void *src, int n )
+NO_LIBCALL void *memmove( void *dest, const void *src, int n )
 {
-   if( dest <= src )
+   // A forward copy is safe as long as the destination doesn't start
+   // inside the source.  memcpy always reads ahead of where it writes.
+   if( (dest <= src) || ((uint8_t*)dest >= (uint8_t*)src + n) )
       return memcpy( dest, src, n );
 
-   uint8_t *dptr = (uint8_t*)dest;
-   const uint8_t *sptr = (uint8_t*)src;
+   // Otherwise copy from the end back
+   uint8_t *dptr = (uint8_t*)dest + n;
+   const uint8_t *sptr = (uint8_t*)src + n;
 
-   dptr += (n-1);
-   sptr += (n-1);
+   // Words can only be used if both ends line up
+   if( (n >= WORD_MIN_LEN) && (Misalign(dptr) == Misalign(sptr)) )
+   {
+      while( Misalign(dptr) )
+      {
+         *--dptr = *--sptr;
+         n--;
+      }
 
-   for( int i=0; i<n; i++ )
-      *dptr-- = *sptr--;
+      uint32_t *dw = (uint32_t*)dptr;
+      const uint32_t *sw = (const uint32_t*)sptr;
+      for( ; n >= 16; n -= 16 )
+      {
+         dw -= 4;
+         sw -= 4;
+         uint32_t a = sw[3], b = sw[2], c = sw[1], d = sw[0];
+         dw[3] = a;
+         dw[2] = b;
+         dw[1] = c;
+         dw[0] = d;
+      }
+      for( ; n >= 4; n -= 4 )
+         *--dw = *--sw;
+
+      dptr = (uint8_t*)dw;
+      sptr = (const uint8_t*)sw;
+   }
+
+   while( n-- > 0 )
+      *--dptr = *--sptr;
    return dest;
 }
 
@@ -47,6 +172,26 @@ int memcmp(const void *s1, const void *s2, int n)
 {
    const uint8_t *p1 = (uint8_t*)s1;
    const uint8_t *p2 = (uint8_t*)s2;
+
+   // When the blocks have the same alignment, skip over matching
+   // words.  The first difference is then found a byte at a time.
+   if( (n >= WORD_MIN_LEN) && (Misalign(p1) == Misalign(p2)) )
+   {
+      while( Misalign(p1) )
+      {
+         int diff = *p1++ - *p2++;
+         if( diff ) return diff;
+         n--;
+      }
+
+      while( (n >= 4) && (*(uint32_t*)p1 == *(uint32_t*)p2) )
+      {
+         p1 += 4;
+         p2 += 4;
+         n -= 4;
+      }
+   }
+
    for( int i=0; i<n; i++ )
    {
       int diff = *p1++ - *p2++;
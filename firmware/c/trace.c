@@ -42,7 +42,7 @@
 #define CTRL_RESERVED       0xFFFC
 
 // local functions
-static int SetCtrl( VarInfo *info, uint8_t *buff, int len );
+static int SetCtrl( VarInfo *info, uint8_t *buff, int off, int len );
 
 // Trace data is located at a fixed memory location
 #define TRACE_DATA_ADDR 0x20006000
@@ -97,6 +97,7 @@ void TraceInit( void )
    VarInit( &varTraceVar[3], VARID_TRACE_VAR4,   "trace_var4",    VAR_TYPE_INT16, &varID[3], 0 );
 
    varCtrl.set = SetCtrl;
+   varPeriod.units = "loops";
 }
 
 // This is called at the end of the high priority main loop.
@@ -136,14 +137,14 @@ void SaveTrace( void )
 }
 
 // Function called when trace control variable is set
-static int SetCtrl( VarInfo *info, uint8_t *buff, int len )
+static int SetCtrl( VarInfo *info, uint8_t *buff, int off, int len )
 {
    // Call the standard set function, but have it save
    // the value to a temporary location
    uint16_t tmp;
    info->ptr = &tmp;
 
-   int err = VarSet16( info, buff, len );
+   int err = VarSet16( info, buff, off, len );
    info->ptr = &ctrl;
 
    if( err ) return err;
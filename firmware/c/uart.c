@@ -1,19 +1,76 @@
 /* uart.c */
 
+// UART driver.
+//
+// Both directions use DMA so the processor isn't interrupted for every
+// byte.  Received data is written by DMA1 channel 5 into a circular
+// buffer which it wraps around on its own.  The background reads the
+// DMA channel's count register to find out how much has arrived.
+// The count register only gives the position within the buffer, so the
+// channel also interrupts each time it passes the middle or end of the
+// buffer to keep track of how many times it has gone around.  If the
+// background falls a whole buffer behind, the data in the buffer has
+// been partly overwritten.  It's all thrown away and counted in the
+// uart_dropped variable.  The binary command framing will recover.
+//
+// Transmit data is queued in a second circular buffer and sent by DMA1
+// channel 4, one contiguous block at a time.  The DMA interrupt at the
+// end of each block starts the next one.
+//
+// The baud rate can be changed at run time through the uart_baud
+// variable.
+
 #include <string.h>
+#include "buffer.h"
 #include "cpu.h"
+#include "errors.h"
+#include "timer.h"
 #include "uart.h"
 #include "utils.h"
+#include "vars.h"
 
-#define BAUDRATE     115200
+// Default baud rate at power up
+#define BAUDRATE        115200
 
-// local data
-static uint8_t rxBuff[128];
-static uint8_t txBuff[128];
-static uint8_t rxHead, rxTail;
-static uint8_t txHead, txTail;
+// The UART needs at least 16 clocks per bit
+#define MIN_BAUD        (CLOCK_RATE / 0xFFFF + 1)
+#define MAX_BAUD        (CLOCK_RATE / 16)
+
+// A new baud rate is applied once this long has passed since it was
+// set and the transmitter is idle.  This gives the response to the
+// command that set it time to go out at the old rate.
+#define BAUD_DELAY_USEC 10000
+
+// Buffer sizes.  Must be powers of 2
+#define RX_BUFF_LEN     256
+#define TX_BUFF_LEN     256
+
+// DMA channels, counting from 0
+#define DMA_CHAN_TX     3
+#define DMA_CHAN_RX     4
+
+// Interrupt flags for the DMA channels
+#define DMA_INT_TX      (0x0F << (4*DMA_CHAN_TX))
+#define DMA_INT_RX      (0x0F << (4*DMA_CHAN_RX))
 
-// Init UART 
+// local functions
+static void StartTx( void );
+static int SetBaud( VarInfo *info, uint8_t *buff, int off, int len );
+
+// local data
+CIRC_BUFF( rxBuff, RX_BUFF_LEN );
+CIRC_BUFF( txBuff, TX_BUFF_LEN );
+static uint16_t txLen;
+static uint32_t baudRate;
+static uint8_t newBaud;
+static uint16_t baudTime;
+static volatile uint16_t rxDma;
+static volatile uint8_t rxLost;
+static uint32_t rxDropCt;
+static VarInfo varBaud;
+static VarInfo varDropCt;
+
+// Init UART
 int UART_Init( void )
 {
    // Pins PA9 and PA10 are used as TX and RX for the UART.
@@ -22,184 +79,244 @@ int UART_Init( void )
    GPIO_PinAltFunc( DIGIO_A_BASE, 10, 7 );
 
    UART_Regs *reg = (UART_Regs*)UART1_BASE;
+   DMA_Reg *dma = (DMA_Reg *)DMA1_BASE;
 
    // Set baud rate register
+   baudRate = BAUDRATE;
    reg->baud = Clip16u( CLOCK_RATE / BAUDRATE );
 
-   // Enable the UART and receive interrupts
-   reg->ctrl[0] = 0x002D;
-//reg->ctrl[0] = 0x000D;
+   // Enable DMA for both transmit and receive.  I also disable the
+   // overrun error since it would stop the receive DMA.
+   reg->ctrl[2] = 0x000010C0;
+
+   // Enable the UART transmitter and receiver.
+   // No UART interrupts are used.
+   reg->ctrl[0] = 0x000D;
+
+   // Assign the UART to DMA channels 4 and 5.  The
+   // display shares this register, so I leave its bits alone.
+   dma->chanSel = (dma->chanSel & ~0x000FF000) | 0x00022000;
+
+   // The receive channel runs continuously in circular mode with
+   // interrupts at the half way point and the end of the buffer
+   dma->channel[DMA_CHAN_RX].config = 0;
+   dma->channel[DMA_CHAN_RX].pAddr  = (uint32_t)&reg->rxDat;
+   dma->channel[DMA_CHAN_RX].mAddr  = (uint32_t)rxBuff.buff;
+   dma->channel[DMA_CHAN_RX].count  = RX_BUFF_LEN;
+   dma->channel[DMA_CHAN_RX].config = 0x000000A7;
 
-   EnableInterrupt( INT_VECT_UART1, 3 );
+   // The transmit channel is set up for memory to peripheral with
+   // an interrupt at the end, but is only enabled when sending.
+   dma->channel[DMA_CHAN_TX].config = 0x00000092;
+   dma->channel[DMA_CHAN_TX].pAddr  = (uint32_t)&reg->txDat;
+
+   EnableInterrupt( INT_VECT_DMA1_4, 3 );
+   EnableInterrupt( INT_VECT_DMA1_5, 3 );
+
+   VarInit( &varBaud, VARID_UART_BAUD, "uart_baud", VAR_TYPE_INT32, &baudRate, 0 );
+   varBaud.set = SetBaud;
+   varBaud.units = "bps";
+
+   VarInit( &varDropCt, VARID_UART_DROPPED, "uart_dropped", VAR_TYPE_INT32, &rxDropCt, VAR_FLG_READONLY );
 
    return 0;
 }
 
-// Add the byte the the transmit queue.
-// Return 1 on success or 0 if the queue is full.
-// This starts a transmit if the UART is currently not sending.
-int UART_SendByte( uint8_t dat )
+// The receive DMA is the real producer for the receive buffer, so
+// before reading I move the buffer head up to where DMA has written.
+// rxDma is read before the count register.  If the interrupt moves
+// it on in between, the DMA position is still ahead of the old value.
+static void RxUpdate( void )
 {
-   UART_Regs *reg = (UART_Regs*)UART1_BASE;
-
-   int ok = 1;
-   int p = IntSuspend();
+   DMA_Reg *dma = (DMA_Reg *)DMA1_BASE;
+   uint16_t base = rxDma;
+   int pos = RX_BUFF_LEN - dma->channel[DMA_CHAN_RX].count;
 
-   // See if the transmit buffer is empty and transmit ints are disabled
-   if( (txHead == txTail) && !(reg->ctrl[0] & 0x0080) )
-   {
-      // Send the byte and enable transmit interrupts
-      reg->txDat = dat;
-      reg->ctrl[0] |= 0x0080;
-   }
+   rxBuff.head = base + ((pos - base) & (RX_BUFF_LEN-1));
 
-   // Otherwise, add this to the transmit buffer
-   else
+   // If the DMA has lapped the reader, drop everything in the buffer.
+   // The interrupt may have noticed first, otherwise it's counted here.
+   int p = IntSuspend();
+   if( rxLost || (BuffUsed( &rxBuff ) > RX_BUFF_LEN) )
    {
-      uint8_t newHead = txHead + 1;
-      if( newHead >= sizeof(txBuff) ) 
-         newHead = 0;
-
-      if( newHead == txTail )
-         ok = 0;
-      else
-      {
-         txBuff[ txHead ] = dat;
-         txHead = newHead;
-      }
+      if( !rxLost )
+         rxDropCt++;
+      BuffGetDone( &rxBuff, BuffUsed( &rxBuff ) );
+      rxLost = 0;
    }
-
    IntRestore(p);
-   return ok;
+}
+
+// Add the byte the the transmit queue.
+// Return 1 on success or 0 if the queue is full.
+// This starts a transmit if the UART is currently not sending.
+int UART_SendByte( uint8_t dat )
+{
+   return UART_Send( &dat, 1 );
 }
 
 // Add the passed date to the transmit queue and start sending it.
 // The number of bytes added to the queue is returned
 int UART_Send( uint8_t dat[], int ct )
 {
-   for( int i=0; i<ct; i++ )
-   {
-      if( !UART_SendByte( dat[i] ) )
-         return i;
-   }
+   ct = BuffAdd( &txBuff, dat, ct );
+   UART_TxDone( 0 );
    return ct;
 }
 
-// Send the passed string 
+// Send the passed string
 // Returns the number of characters sent
 int UART_SendStr( const char *str )
 {
-   int i;
-   for( i=0; *str; i++ )
-   {
-      if( !UART_SendByte( (uint8_t)*str++ ) )
-         break;
-   }
-   return i;
+   return UART_Send( (uint8_t *)str, strlen(str) );
 }
 
 // Read the next byte from the receive buffer
 // Return the byte value, or -1 if none are available
 int UART_Recv( void )
 {
-   int ret;
-   int p = IntSuspend();
-   if( rxHead == rxTail )
-      ret = -1;
-   else
-   {
-      ret = rxBuff[ rxTail++ ];
-      if( rxTail >= sizeof(rxBuff) )
-         rxTail = 0;
-   }
-   IntRestore(p);
-
-   return ret;
+   RxUpdate();
+   return BuffGetByte( &rxBuff );
 }
 
 // Return the number of bytes in our receive buffer
 int UART_RxFull( void )
 {
-   int p = IntSuspend();
-   int h = rxHead;
-   int t = rxTail;
-   IntRestore(p);
-
-   int ct = h-t;
-   if( ct < 0 ) ct += sizeof(rxBuff);
-   return ct;
+   RxUpdate();
+   return BuffUsed( &rxBuff );
 }
 
 // Return the number of free spaces in the transmit buffer
 int UART_TxFree( void )
 {
-   int p = IntSuspend();
-   int h = txHead;
-   int t = txTail;
-   IntRestore(p);
+   return BuffFree( &txBuff );
+}
 
-   int ct = h-t;
-   if( ct < 0 ) ct += sizeof(txBuff);
+// Get a pointer to the received data that can be read in
+// one contiguous block, and return the number of bytes there.
+// The data stays in the buffer until UART_RxDone is called.
+int UART_RxSpan( uint8_t **ptr )
+{
+   RxUpdate();
+   return BuffGetSpan( &rxBuff, ptr );
+}
 
-   return sizeof(txBuff) - 1 - ct;
+// Remove bytes read through UART_RxSpan from the receive buffer
+void UART_RxDone( int ct )
+{
+   BuffGetDone( &rxBuff, ct );
+}
+
+// Get a pointer to the contiguous free space in the transmit
+// buffer and return its length.  Data written there is sent
+// once UART_TxDone is called.
+int UART_TxSpan( uint8_t **ptr )
+{
+   return BuffAddSpan( &txBuff, ptr );
+}
+
+// Add ct bytes written through UART_TxSpan to the transmit
+// queue and make sure the transmitter is running.
+void UART_TxDone( int ct )
+{
+   BuffAddDone( &txBuff, ct );
+
+   int p = IntSuspend();
+   if( !txLen )
+      StartTx();
+   IntRestore(p);
 }
 
 // Flush the receive buffer
 int UART_FlushRx( void )
 {
+   RxUpdate();
+   BuffGetDone( &rxBuff, BuffUsed( &rxBuff ) );
+   return 0;
+}
+
+// Called from the background loop.
+// Applies a new baud rate once it's safe to do so.
+void PollUART( void )
+{
+   if( !newBaud || (UsecSince( baudTime ) < BAUD_DELAY_USEC) )
+      return;
+
+   UART_Regs *reg = (UART_Regs*)UART1_BASE;
+
+   // Wait until all queued data has been sent, including
+   // the last byte in the UART's shift register
    int p = IntSuspend();
-   rxHead = rxTail = 0;
+   int idle = !txLen && !BuffUsed( &txBuff ) && (reg->status & 0x0040);
    IntRestore(p);
 
-   return 0;
+   if( !idle )
+      return;
+
+   // The baud rate register can only be changed
+   // with the UART disabled.
+   reg->ctrl[0] &= ~1;
+   reg->baud = Clip16u( (CLOCK_RATE + baudRate/2) / baudRate );
+   reg->ctrl[0] |= 1;
+   newBaud = 0;
+}
+
+static int SetBaud( VarInfo *info, uint8_t *buff, int off, int len )
+{
+   uint32_t baud = b2u32( buff );
+   if( (baud < MIN_BAUD) || (baud > MAX_BAUD) )
+      return ERR_RANGE;
+
+   baudRate = baud;
+   baudTime = TimerGetUsec();
+   newBaud = 1;
+   return ERR_OK;
+}
+
+// Start sending the next contiguous block of the transmit buffer.
+// Called with interrupts disabled or from the ISR.
+static void StartTx( void )
+{
+   DMA_Reg *dma = (DMA_Reg *)DMA1_BASE;
+
+   uint8_t *ptr;
+   txLen = BuffGetSpan( &txBuff, &ptr );
+   if( !txLen )
+      return;
+
+   dma->channel[DMA_CHAN_TX].config &= ~1;
+   dma->channel[DMA_CHAN_TX].mAddr = (uint32_t)ptr;
+   dma->channel[DMA_CHAN_TX].count = txLen;
+   dma->channel[DMA_CHAN_TX].config |= 1;
 }
 
+// DMA transmit complete interrupt.
+// Frees the block that was just sent and starts the next.
 void UART_ISR( void )
 {
-   UART_Regs *reg = (UART_Regs*)UART1_BASE;
+   DMA_Reg *dma = (DMA_Reg *)DMA1_BASE;
 
-//   if( reg->status & 0x0002 )
-//   {
-//      uint8_t dat = reg->data;
-//   }
-
-   // Check for over run error and clear it if set
-   // This can happen when erasing/writing flash because
-   // the processor stalls out waiting for code.
-   // I don't care too much, but need to clear the status
-   // bit because if I don't I'll keep getting interrupts.
-   if( reg->status & 0x0008 )
-      reg->intClear = 0x0008;
-
-   // See if we received a new byte
-   if( reg->status & 0x0020 )
-   {
-      uint8_t val = reg->rxDat;
+   dma->intClr = DMA_INT_TX;
+   dma->channel[DMA_CHAN_TX].config &= ~1;
 
-      uint8_t newHead = (rxHead+1);
-      if( newHead >= sizeof(rxBuff) )
-         newHead = 0;
+   BuffGetDone( &txBuff, txLen );
+   txLen = 0;
+   StartTx();
+}
 
-      if( newHead != rxTail )
-      {
-         rxBuff[ rxHead ] = val;
-         rxHead = newHead;
-      }
-   }
+// DMA receive interrupt, at the half way point and end of the buffer.
+// Keeps count of how far the DMA has written and checks whether it
+// has overwritten data the background hasn't read yet.
+void UART_RxISR( void )
+{
+   DMA_Reg *dma = (DMA_Reg *)DMA1_BASE;
+   dma->intClr = DMA_INT_RX;
+
+   rxDma += RX_BUFF_LEN/2;
 
-   // Check for transmit data register empty
-   if( reg->status & reg->ctrl[0] & 0x0080 )
+   if( !rxLost && ((int16_t)(rxDma - rxBuff.tail) > RX_BUFF_LEN) )
    {
-      // If there's nothing left in the transmit buffer, 
-      // just disable further transmit interrupts.
-      if( txHead == txTail )
-         reg->ctrl[0] &= ~0x0080;
-      else
-      {
-         // Send the next byte
-         reg->txDat = txBuff[ txTail++ ];
-         if( txTail >= sizeof(txBuff) )
-            txTail = 0;
-      }
+      rxLost = 1;
+      rxDropCt++;
    }
 }
@@ -1,6 +1,7 @@
 /* ui.c */
 
 #include "calc.h"
+#include "chart.h"
 #include "display.h"
 #include "encoder.h"
 #include "io.h"
@@ -11,26 +12,110 @@
 #include "trace.h"
 #include "ui.h"
 #include "utils.h"
+#include "widget.h"
 
-typedef void (*ScreenFunc)(void);
+// A screen is a list of widgets
+typedef struct
+{
+   Widget *list;
+   int ct;
+} Screen;
+
+#define SCREEN( list )   { list, ARRAY_CT(list) }
+
+// Height of a row of text in each font
+#define ROW_12         14
+#define ROW_16         19
+
+// Row for the large readout at the bottom of the summary screen
+#define BIG_TOP        30
+
+// The graphs start at the first whole page below the title
+#define GRAPH_TOP      24
 
 // local functions
-static void SummaryScreen( void );
-static void ShowPressureGraph( void );
-static void ShowFlowGraph( void );
-static void ShowDebug( void );
-
-// List of screen functions.
-static ScreenFunc screens[] =
-{
-   SummaryScreen,
-   ShowPressureGraph,
-   ShowFlowGraph,
-   ShowDebug,
+static float PresAvg( void );
+static float FlowAvg( void );
+static int32_t PresGraphState( void );
+static void DrawPresGraph( const Widget *w );
+static void DrawFlowGraph( const Widget *w );
+static int32_t PVState( void );
+static void DrawPVLoop( const Widget *w );
+static int32_t DebugState( void );
+static void DrawDebug( const Widget *w );
+
+// Summary screen.  Default at startup.
+// Shows a list of interesting parameters
+static Widget summaryScreen[] =
+{
+   WIDGET_TEXT(    0, 0,      34, FONT_FREESANS_12, "Flow:" ),
+   WIDGET_NUMBER( 34, 0,          FONT_FREESANS_12, 4, 0, GetFlowRate, 1 ),
+   WIDGET_TEXT(   64, 0,      64, FONT_FREESANS_12, "ml/sec" ),
+   WIDGET_TEXT(    0, ROW_12, 34, FONT_FREESANS_12, "Pres:" ),
+   WIDGET_NUMBER( 34, ROW_12,     FONT_FREESANS_12, 4, 0, GetPressure1, PRESSURE_CM_H2O ),
+   WIDGET_TEXT(   64, ROW_12, 64, FONT_FREESANS_12, "cm" ),
+   WIDGET_NUMBER(  0, BIG_TOP,    FONT_BIG_DIGITS,  4, 0, GetTV, 1 ),
+   WIDGET_TEXT(   80, DISP_ROWS-16, 48, FONT_FREESANS_12, "ml TV" ),
+};
+
+static Widget presScreen[] =
+{
+   WIDGET_TEXT(    0, 0, 42, FONT_FREESANS_16, "Pres:" ),
+   WIDGET_NUMBER( 42, 0,     FONT_FREESANS_16, 3, 0, PresAvg, PRESSURE_CM_H2O ),
+   WIDGET_TEXT(   72, 0, 56, FONT_FREESANS_16, "cmH2O" ),
+   WIDGET_CUSTOM( 0, GRAPH_TOP, DISP_COLS, DISP_ROWS-GRAPH_TOP, PresGraphState, DrawPresGraph ),
+};
+
+static Widget flowScreen[] =
+{
+   WIDGET_TEXT(    0, 0, 42, FONT_FREESANS_16, "Flow:" ),
+   WIDGET_NUMBER( 42, 0,     FONT_FREESANS_16, 4, 0, FlowAvg, 1 ),
+   WIDGET_TEXT(   80, 0, 48, FONT_FREESANS_16, "ml/sec" ),
+   WIDGET_CUSTOM( 0, GRAPH_TOP, DISP_COLS, DISP_ROWS-GRAPH_TOP, PresGraphState, DrawFlowGraph ),
+};
+
+static Widget pvScreen[] =
+{
+   WIDGET_CUSTOM( 0, 0, DISP_COLS, DISP_ROWS, PVState, DrawPVLoop ),
+};
+
+static Widget debugScreen[] =
+{
+   WIDGET_CUSTOM( 0, 0, DISP_COLS, DISP_ROWS, DebugState, DrawDebug ),
+};
+
+// List of screens.
+static const Screen screens[] =
+{
+   SCREEN( summaryScreen ),
+   SCREEN( presScreen ),
+   SCREEN( flowScreen ),
+   SCREEN( pvScreen ),
+   SCREEN( debugScreen ),
 };
 
 // local data
 static uint32_t lastUpdt;
+static int crntScreen = -1;
+
+// The graph screens share one strip chart, which
+// is set up again when switching between them.
+static StripChart chart;
+
+// The PV loop is drawn into its own buffer and copied into each frame.
+// Only the segments added since the last frame are drawn, unless a new
+// breath starts or the scale changes.  The scale is in 0.1 cmH2O and
+// 0.1 ml units, like the points.
+#define PV_PRES_STEP   50        // Pressure scale is a multiple of 5 cmH2O
+#define PV_VOL_STEP    1000      // Volume scale is a multiple of 100 ml
+static uint8_t pvCanvas[ DISP_PAGES ][ DISP_COLS ];
+static uint32_t pvBreath;
+static int pvDrawn;
+static int pvMaxP, pvMaxV;
+static int pvScaleP, pvScaleV;
+
+static const char *dbgStr[4];
+static uint32_t dbgCt;
 
 // Called once at startup
 void InitUserInterface( void )
@@ -40,14 +125,15 @@ void InitUserInterface( void )
 // Called by the background loop
 void PollUserInterface( void )
 {
-   // I update the display every 50ms
-   if( LoopsSince( lastUpdt ) < MsToLoop( 50 ) )
+   // The screen is checked for changes once the display has taken the
+   // last frame, so the frame rate follows how fast the changes can be
+   // sent.  It's limited to once every 20ms though, since there's no
+   // point in redrawing much faster than the display responds.
+   if( !DisplayReady() || (LoopsSince( lastUpdt ) < MsToLoop( 20 )) )
       return;
 
    lastUpdt = GetLoopCt();
 
-   ClearDisplay();
-
    // I use the encoder to select which screen to display
    // Each detent of the encoder is 4 counts, so I drop the
    // bottom two counts.  
@@ -57,107 +143,192 @@ void PollUserInterface( void )
    s = s % tot;
    if( s < 0 ) s += tot;
 
-   // Call the screen specific function to add info to the
-   // display.
-   screens[s]();
+   // A new screen starts from a blank display with
+   // all its widgets needing to be drawn.
+   const Screen *scr = &screens[s];
+   if( s != crntScreen )
+   {
+      crntScreen = s;
+      ClearDisplay();
+      WidgetInvalidate( scr->list, scr->ct );
+   }
 
-   // Copy the local display info to the OLED 
-   UpdateDisplay();
+   // Redraw whatever changed, and only send a
+   // new frame to the OLED if something did.
+   if( WidgetUpdate( scr->list, scr->ct ) )
+      UpdateDisplay();
 }
 
-// Summary screen.  Default at startup.
-// Shows a list of interesting parameters
-static void SummaryScreen( void )
+static float PresAvg( void )
 {
-   char buff[80];
-
-   SetFont( FONT_FREESANS_12 );
-
-   // Find height of each row of text
-   int dy = CrntFont()->yAdv;
-   int y = 0;
+   return GetPresAvg( 200 );
+}
 
-   sprintf( buff, "Flow: % 3d ml/sec", (int)GetFlowRate() );
-   DrawString( buff, 0, y );
+static float FlowAvg( void )
+{
+   return GetFlowAvg( 200 );
+}
 
-   y+= dy;
-   sprintf( buff, "Pres: %4d cm", (int)(GetPressure1() * PRESSURE_CM_H2O) );
-   DrawString( buff, 0, y );
+// Both graphs change when a new history sample arrives
+static int32_t PresGraphState( void )
+{
+   return GetHistSeq();
 }
 
-static void ShowPressureGraph( void )
+// Draw the pressure history as a connected trace
+static void DrawPresGraph( const Widget *w )
 {
-   SetFont( FONT_FREESANS_16 );
+   ChartSetup( &chart, GetPresHistAt, 0, 1, w->y, 0 );
+   ChartDraw( &chart, GetHistSeq() );
+}
 
-   int y = 0;
+// Fill the area under the flow curve
+static void DrawFlowGraph( const Widget *w )
+{
+   ChartSetup( &chart, GetFlowHistAt, 0, 1000, w->y, 1 );
+   ChartDraw( &chart, GetHistSeq() );
+}
 
-   char buff[80];
-   sprintf( buff, "Pres: %4d cmH2O", (int)(GetPresAvg(200) * PRESSURE_CM_H2O) );
-   DrawString( buff, 0, y );
+// Round a scale up to the next multiple of step, with a minimum of one step
+static int RoundScale( int max, int step )
+{
+   if( max < step ) return step;
+   return ((max + step - 1) / step) * step;
+}
 
-   y += CrntFont()->yAdv + 4;
+// Convert a PV point to a pixel location on the PV screen
+static void PVtoXY( const PVPoint *pt, int *x, int *y )
+{
+   int p = pt->pres < 0 ? 0 : pt->pres;
+   int v = pt->vol  < 0 ? 0 : pt->vol;
 
-   int graphHeight = 64 - y;
+   *x = p * (DISP_COLS-1) / pvScaleP;
+   *y = DISP_ROWS-1 - v * (DISP_ROWS-1-ROW_12) / pvScaleV;
+}
 
-   for( int i=0; i<128; i++ )
+// Track the largest pressure and volume in a list of points
+static void PVMax( const PVPoint *pts, int ct )
+{
+   for( int i=0; i<ct; i++ )
    {
-      float p = GetPresHistory( i );
-      if( p < 0 ) p = 0;
-      if( p > 1 ) p = 1;
+      if( pts[i].pres > pvMaxP ) pvMaxP = pts[i].pres;
+      if( pts[i].vol  > pvMaxV ) pvMaxV = pts[i].vol;
+   }
+}
 
-      p *= (float)graphHeight;
+// Draw the segments of a breath from point n1 to n2 into the
+// PV canvas.  The previous breath is drawn as dots.
+static void DrawPVSegs( const PVPoint *pts, int n1, int n2, int dots )
+{
+   int x1, y1, x2, y2;
+   if( n1 < 0 ) n1 = 0;
+   if( n1 >= n2 ) return;
+
+   PVtoXY( &pts[n1], &x1, &y1 );
+   if( dots || (n2-n1 == 1) )
+      SetPixel( x1, y1 );
 
-      SetPixel( i, 63 - p );
+   for( int i=n1+1; i<n2; i++ )
+   {
+      PVtoXY( &pts[i], &x2, &y2 );
+      if( dots )
+         SetPixel( x2, y2 );
+      else
+         DrawLine( x1, y1, x2, y2, DRAW_SET );
+      x1 = x2;
+      y1 = y2;
    }
 }
 
-static void ShowFlowGraph( void )
+// The PV loop changes with each new point and each new breath
+static int32_t PVState( void )
 {
-   SetFont( FONT_FREESANS_16 );
-
-   int y = 0;
+   int ct;
+   GetPVPoints( 0, &ct );
+   return (GetBreathCount() << 9) + ct;
+}
 
-   char buff[80];
-   sprintf( buff, "Flow: %3d ml/sec", (int)GetFlowAvg(200) );
-   DrawString( buff, 0, y );
+// Pressure / volume loop for the current and previous breath.
+// Pressure is on the x axis and volume on the y axis.
+static void DrawPVLoop( const Widget *w )
+{
+   char buff[40];
 
-   y += CrntFont()->yAdv + 4;
+   SetFont( FONT_FREESANS_12 );
 
-   int graphHeight = 64 - y;
+   uint32_t breath = GetBreathCount();
+   int curCt, prevCt;
+   const PVPoint *cur  = GetPVPoints( 0, &curCt );
+   const PVPoint *prev = GetPVPoints( 1, &prevCt );
 
-   for( int i=0; i<128; i++ )
+   // At the start of a breath the scale is set from the previous breath
+   int redraw = 0;
+   if( breath != pvBreath )
    {
-      float f = GetFlowHistory( i );
-      if( f < 0 ) f = 0;
-      if( f > 1000 ) f = 1000;
+      pvBreath = breath;
+      pvMaxP = pvMaxV = 0;
+      PVMax( prev, prevCt );
+      pvDrawn = 0;
+      redraw = 1;
+   }
 
-      f *= (float)graphHeight / 1000.0;
+   // The scale only grows during a breath
+   PVMax( &cur[pvDrawn], curCt-pvDrawn );
+   int sp = RoundScale( pvMaxP, PV_PRES_STEP );
+   int sv = RoundScale( pvMaxV, PV_VOL_STEP );
+   if( (sp != pvScaleP) || (sv != pvScaleV) )
+   {
+      pvScaleP = sp;
+      pvScaleV = sv;
+      redraw = 1;
+   }
 
-      SetPixel( i, 63 - f );
+   SetDrawTarget( pvCanvas );
+   if( redraw )
+   {
+      ClearDisplay();
+      DrawPVSegs( prev, 0, prevCt, 1 );
+      pvDrawn = 0;
    }
+
+   // Draw the new segments, starting at the last point drawn
+   // so they connect to the ones before
+   DrawPVSegs( cur, pvDrawn-1, curCt, 0 );
+   pvDrawn = curCt;
+   SetDrawTarget( 0 );
+
+   DrawBitmap( pvCanvas[0], 0, 0, DISP_COLS, DISP_ROWS, DRAW_SET );
+
+   // Axis labels show the full scale values
+   sprintf( buff, "%d ml", pvScaleV/10 );
+   DrawString( buff, 0, 0 );
+
+   sprintf( buff, "%d cm", pvScaleP/10 );
+   DrawString( buff, 80, 0 );
 }
 
-static const char *dbgStr[4];
 void AddDebugStr( const char *str )
 {
    for( int i=2; i>=0; i-- )
       dbgStr[i+1] = dbgStr[i];
    dbgStr[0] = str;
+   dbgCt++;
 }
 
-static void ShowDebug( void )
+static int32_t DebugState( void )
+{
+   return dbgCt;
+}
+
+static void DrawDebug( const Widget *w )
 {
    SetFont( FONT_FREESANS_12 );
 
-   // Find height of each row of text
-   int dy = CrntFont()->yAdv;
    int y = 0;
-
    for( int i=0; i<4; i++ )
    {
       if( dbgStr[i] )
          DrawString( dbgStr[i], 0, y );
-      y += dy;
+      y += ROW_12;
    }
 }
-
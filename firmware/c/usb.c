@@ -15,6 +15,18 @@
 #define EPSTAT_NAK         2
 #define EPSTAT_VALID       3
 
+// Endpoint register bits
+#define EP_CTR_RX          0x8000
+#define EP_SW_BUF_TX       0x4000
+#define EP_CTR_TX          0x0080
+#define EP_DTOG_TX         0x0040
+
+// Max packet size of the bulk data endpoints
+#define BULK_PKT_LEN       64
+
+// Number of entries in the buffer table
+#define NUM_EP             6
+
 // local functions
 static void HandleReset( void );
 static void HandleXfer( void );
@@ -23,6 +35,7 @@ static void ClearEpStat( int N, uint32_t stat );
 static void SetEpTxStat( int ndx, int stat );
 static void SetEpRxStat( int ndx, int stat );
 static int InitTblEntry( int N, int offset, int txLen, int rxLen );
+static int InitDblTxEntry( int N, int offset, int txLen );
 
 typedef struct
 {
@@ -32,10 +45,42 @@ typedef struct
    const uint8_t *data;
 } EPinfo;
 
+// Each port is a pair of bulk endpoints along with the buffers used to
+// pass data to and from the background.
+//
+// The IN endpoint is double buffered, so the hardware can be sending
+// one packet while the next is loaded.  The OUT endpoint is left NAKing
+// while the receive buffer doesn't have room for a full packet.  The
+// host just retries, so no data is lost however slowly the background
+// reads it.
+typedef struct
+{
+   CircBuff *tx;
+   CircBuff *rx;
+   uint8_t inEP;
+   uint8_t outEP;
+   uint8_t txPend;                // Packets loaded but not yet sent (0-2)
+   uint8_t txLast;                // Length of the last packet loaded
+   uint8_t rxHeld;                // Set while the OUT endpoint is held off
+} USBport;
+
+static void FillTx( USBport *port );
+static void CheckRxSpace( USBport *port );
+
 // local data
 static EPinfo epInfo[4];
 static uint8_t address;
-static CircBuff txBuff, rxBuff;
+static uint8_t configured;
+CIRC_BUFF( cdcTx, 256 );
+CIRC_BUFF( cdcRx, 256 );
+CIRC_BUFF( bulkTx, 1024 );
+CIRC_BUFF( bulkRx, 256 );
+
+static USBport ports[USB_NUM_PORTS] =
+{
+   { &cdcTx,  &cdcRx,  3, 2 },      // USB_PORT_CDC
+   { &bulkTx, &bulkRx, 5, 4 },      // USB_PORT_BULK
+};
 
 void InitUSB( void )
 {
@@ -61,8 +106,9 @@ void InitUSB( void )
    // which should be plenty I would think.
    BusyWait( 1000 );
 
-   // Take the USB module out of reset and clear any bogus interrupts
-   usb->ctrl = 0x00000000;
+   // Take the USB module out of reset and clear any bogus interrupts.
+   // Transfer complete and reset events are handled in the interrupt.
+   usb->ctrl = 0x00008400;
 
    // Clear the status.  This doesn't seem to clear if I don't delay 
    // briefly first.
@@ -81,78 +127,108 @@ void InitUSB( void )
    // The start of this buffer holds a table of pointers and sizes
    // used to assign the remaining memory to the various USB endpoints.
 
-   int off = 4*sizeof(USB_TblEntry);
+   int off = NUM_EP*sizeof(USB_TblEntry);
    off = InitTblEntry( 0, off, 64, 64 );
    off = InitTblEntry( 1, off,  8,  0 );
-   off = InitTblEntry( 2, off,  0, 64 );
-   off = InitTblEntry( 3, off, 64,  0 );
+   off = InitTblEntry( 2, off,  0, BULK_PKT_LEN );
+   off = InitDblTxEntry( 3, off, BULK_PKT_LEN );
+   off = InitTblEntry( 4, off,  0, BULK_PKT_LEN );
+   off = InitDblTxEntry( 5, off, BULK_PKT_LEN );
+
+   EnableInterrupt( INT_VECT_USB, 3 );
 
    // Enable the pull-up resistor on the DP line
    usb->battery = 0x8000;
 }
 
-int USB_SendByte( uint8_t dat )
+// Start receiving on a port's OUT endpoint again once the
+// background has made room for another packet.
+static void CheckRxSpace( USBport *port )
 {
-   return BuffAddByte( &txBuff, dat );
+   if( !port->rxHeld || (BuffFree( port->rx ) < BULK_PKT_LEN) )
+      return;
+
+   int p = IntSuspend();
+   if( port->rxHeld )
+   {
+      port->rxHeld = 0;
+      SetEpRxStat( port->outEP, EPSTAT_VALID );
+   }
+   IntRestore(p);
 }
 
-int USB_Send( uint8_t dat[], int ct )
+// Start sending newly queued data if the endpoint has room for it.
+static void KickTx( USBport *port )
 {
-   return BuffAdd( &txBuff, dat, ct );
+   int p = IntSuspend();
+   if( configured )
+      FillTx( port );
+   IntRestore(p);
 }
 
-int USB_Recv( void )
+int USB_SendByte( int n, uint8_t dat )
 {
-   return BuffGetByte( &rxBuff );
+   return USB_Send( n, &dat, 1 );
 }
 
-int USB_TxFree( void )
+int USB_Send( int n, uint8_t dat[], int ct )
 {
-   return BuffFree( &txBuff );
+   ct = BuffAdd( ports[n].tx, dat, ct );
+   KickTx( &ports[n] );
+   return ct;
 }
 
-void PollUSB( void )
+int USB_Recv( int n )
 {
-   USB_Regs *usb = (USB_Regs *)USBFS_BASE;
+   int ret = BuffGetByte( ports[n].rx );
+   CheckRxSpace( &ports[n] );
+   return ret;
+}
 
-   if( (usb->endpoint[3] & 0x0030) != 0x0030 )
-   {
-      USB_TblEntry *usbTbl = (USB_TblEntry *)USB_SRAM_BASE;
+int USB_TxFree( int n )
+{
+   return BuffFree( ports[n].tx );
+}
 
-      int ct = BuffUsed( &txBuff );
-      int wct = (ct+1)/2;
+// Get a pointer to the received data that can be read in
+// one contiguous block, and return the number of bytes there.
+int USB_RxSpan( int n, uint8_t **ptr )
+{
+   return BuffGetSpan( ports[n].rx, ptr );
+}
 
-      uint16_t *ptr =  (uint16_t *)(USB_SRAM_BASE + usbTbl[3].txAddr);
+// Remove bytes read through USB_RxSpan from the receive buffer
+void USB_RxDone( int n, int ct )
+{
+   BuffGetDone( ports[n].rx, ct );
+   CheckRxSpace( &ports[n] );
+}
 
-      for( int i=0; i<wct; i++ )
-      {
-         uint16_t l = BuffGetByte( &txBuff );
-         uint16_t h = BuffGetByte( &txBuff );
-         if( h & 0xFF00 ) h = 0;
-         *ptr++ = (h<<8) | l;
-      }
+// Get a pointer to the contiguous free space in the transmit
+// buffer and return its length.
+int USB_TxSpan( int n, uint8_t **ptr )
+{
+   return BuffAddSpan( ports[n].tx, ptr );
+}
 
-      if( ct )
-      {
-         usbTbl[3].txCount = ct;
-         SetEpTxStat( 3, EPSTAT_VALID );
-      }
-   }
+// Queue bytes written through USB_TxSpan for transmit
+void USB_TxDone( int n, int ct )
+{
+   BuffAddDone( ports[n].tx, ct );
+   KickTx( &ports[n] );
+}
 
-   if( usb->status )
-   {
-      // Handle a reset event.  We'll get one of these
-      // when the USB cable is plugged in.
-      if( usb->status & 0x0400 )
-      {
-         HandleReset();
-         return;
-      }
+// USB interrupt.  All USB events are handled here.
+void USB_ISR( void )
+{
+   USB_Regs *usb = (USB_Regs *)USBFS_BASE;
 
-      usb->status = 0;
-   }
+   // Handle a reset event.  We'll get one of these
+   // when the USB cable is plugged in.
+   if( usb->status & 0x0400 )
+      HandleReset();
 
-   if( usb->status & 0x8000 )
+   while( usb->status & 0x8000 )
       HandleXfer();
 }
 
@@ -162,6 +238,8 @@ static void HandleReset( void )
 
    usb->status = 0;
 
+   configured = 0;
+
    usb->endpoint[0]  = 0x0200;
    SetEpRxStat( 0, EPSTAT_VALID );
    SetEpTxStat( 0, EPSTAT_NAK );
@@ -280,9 +358,9 @@ static const USBdesc_Device deviceDesc =
    sizeof(USBdesc_Device),  // length
    0x01,                    // Descriptor type
    0x0200,                  // USB spec number in BCD
-   0x02,                    // Device class code
-   0x00,                    // Device sub-class code
-   0x00,                    // Protocol code
+   0xEF,                    // Device class code (miscellaneous)
+   0x02,                    // Device sub-class code (common class)
+   0x01,                    // Protocol code (interface association)
    64,                      // Max packet size (bytes) for endpoint 0
    0x2b74,                  // Vendor ID code
    0x4000,                  // Product ID code
@@ -301,6 +379,7 @@ static const USBdesc_Device deviceDesc =
 typedef struct
 {
    USBdesc_Config         config;      // Configuration descriptor
+   USBdesc_IntfAssoc      cdcAssoc;    // Groups the two CDC interfaces
    USBdesc_Interface      cdcComm;     // CDC communication interface
    USBdesc_CDC_Header     cdcHeader;   // Has CDC version info
    USBdesc_CDC_CallMgmt   cdcCallMgt;  // CDC call management
@@ -310,6 +389,9 @@ typedef struct
    USBdesc_Interface      cdcData;     // CDC data interface
    USBdesc_Endpoint       out;         // Data out endpoint
    USBdesc_Endpoint       in;          // Data in endpoint
+   USBdesc_Interface      bulk;        // Vendor specific bulk interface
+   USBdesc_Endpoint       bulkOut;     // Bulk out endpoint
+   USBdesc_Endpoint       bulkIn;      // Bulk in endpoint
 } __attribute__((__packed__)) FullCfgDesc;
 
 static const FullCfgDesc configDesc =
@@ -319,13 +401,25 @@ static const FullCfgDesc configDesc =
       sizeof(USBdesc_Config),         // Length of descriptor in bytes
       0x02,                           // Descriptor type
       sizeof(FullCfgDesc),            // Total length in bytes including interface and endpoint descriptors
-      0x02,                           // Number of interfaces in configuration
+      0x03,                           // Number of interfaces in configuration
       0x01,                           // Index of this configuration
       0x00,                           // String index of config name
       0x80,                           // Configuration attributes bit-map
       100                             // Max power draw in 2mA units
    },
 
+   // Interface association for the CDC interfaces
+   {
+      sizeof(USBdesc_IntfAssoc),      // Length of descriptor in bytes
+      0x0B,                           // Descriptor type
+      0x00,                           // First interface
+      0x02,                           // Number of interfaces
+      0x02,                           // Function class code (CDC)
+      0x02,                           // Function sub-class code (abstract control module)
+      0x01,                           // Function protocol code (V.250)
+      0x00,                           // String index of function name
+   },
+
    // CDC communication interface
    { 
       sizeof(USBdesc_Interface),      // Length of descriptor in bytes
@@ -414,6 +508,40 @@ static const FullCfgDesc configDesc =
       0x02,                           // Attributes bit-map
       64,                             // Max packet size
       0x01,                           // Polling interval 
+   },
+
+   // Vendor specific bulk interface.  This carries binary commands and
+   // bulk data without tying up the virtual serial port.
+   { 
+      sizeof(USBdesc_Interface),      // Length of descriptor in bytes
+      0x04,                           // Descriptor type
+      0x02,                           // Index of this interface
+      0x00,                           // Alternate setting index
+      0x02,                           // Number of endpoints 
+      0xFF,                           // Interface class code (vendor specific)
+      0x00,                           // Sub-class code 
+      0x00,                           // Protocol code
+      0x03,                           // String index of interface name
+   },
+
+   // Bulk output endpoint
+   {
+      sizeof(USBdesc_Endpoint),       // Length of descriptor in bytes
+      0x05,                           // Descriptor type
+      0x04,                           // Endpoint address 
+      0x02,                           // Attributes bit-map
+      64,                             // Max packet size
+      0x01,                           // Polling interval 
+   },
+
+   // Bulk input endpoint
+   {
+      sizeof(USBdesc_Endpoint),       // Length of descriptor in bytes
+      0x05,                           // Descriptor type
+      0x85,                           // Endpoint address 
+      0x02,                           // Attributes bit-map
+      64,                             // Max packet size
+      0x01,                           // Polling interval 
    }
 };
 
@@ -421,6 +549,7 @@ static const char *strings[] =
 {
    "Embedded Intelligence, Inc",
    "Freeflow flow sensor",
+   "Freeflow binary interface",
 };
 
 static int HandleGetDescriptor( USBrqst *rqst )
@@ -486,17 +615,35 @@ static int HandleSetConfig( USBrqst *rqst )
    if( !usb->addr ) return ERR_RANGE;
 
    usb->endpoint[1]  = 0x0301;
-   usb->endpoint[2]  = 0x0002;
-   usb->endpoint[3]  = 0x0003;
 
    SetEpRxStat( 1, EPSTAT_NAK );
    SetEpTxStat( 1, EPSTAT_NAK );
 
-   SetEpRxStat( 2, EPSTAT_VALID );
-   SetEpTxStat( 2, EPSTAT_NAK );
+   for( int i=0; i<USB_NUM_PORTS; i++ )
+   {
+      USBport *port = &ports[i];
+      int in = port->inEP;
+      int out = port->outEP;
+
+      usb->endpoint[out] = out;
+      SetEpRxStat( out, EPSTAT_VALID );
+      SetEpTxStat( out, EPSTAT_NAK );
+      port->rxHeld = 0;
+
+      // The IN endpoint is bulk with the kind bit set for double buffering.
+      // Both buffer flags are toggled back to zero so neither buffer is
+      // loaded.  The status stays valid and the buffer flags decide
+      // when the hardware has something to send.
+      usb->endpoint[in] = 0x8180 | in | (usb->endpoint[in] & (EP_SW_BUF_TX|EP_DTOG_TX));
+      SetEpRxStat( in, EPSTAT_DISABLED );
+      SetEpTxStat( in, EPSTAT_VALID );
+      port->txPend = 0;
+      port->txLast = 0;
+   }
 
-   SetEpRxStat( 3, EPSTAT_NAK );
-   SetEpTxStat( 3, EPSTAT_NAK  );
+   configured = 1;
+   for( int i=0; i<USB_NUM_PORTS; i++ )
+      FillTx( &ports[i] );
 
    return StartResp( 0, 0, 0, 0 );
 }
@@ -595,12 +742,108 @@ static void HandleRecv( int N )
 {
    ClearEpStat( N, 0x8000 );
 
-   if( N == 2 )
+   // The hardware NAKs after each packet until told otherwise,
+   // so I only accept another if there's certain to be room for it.
+   for( int i=0; i<USB_NUM_PORTS; i++ )
    {
+      USBport *port = &ports[i];
+      if( port->outEP != N )
+         continue;
+
       USB_TblEntry *usbTbl = (USB_TblEntry *)USB_SRAM_BASE;
       uint8_t *ptr = (uint8_t*)(USB_SRAM_BASE + usbTbl[N].rxAddr);
-      BuffAdd( &rxBuff, ptr, usbTbl[N].rxCount & 0x01FF );
-      SetEpRxStat( N, EPSTAT_VALID );
+      BuffAdd( port->rx, ptr, usbTbl[N].rxCount & 0x03FF );
+
+      if( BuffFree( port->rx ) >= BULK_PKT_LEN )
+         SetEpRxStat( N, EPSTAT_VALID );
+      else
+         port->rxHeld = 1;
+      return;
+   }
+}
+
+// Copy ct bytes from a pair of buffer spans to USB packet memory.
+// The packet memory can only be written 16 bits at a time.
+static void CopyToPMA( uint16_t *dst, BuffSpan span[2], int ct )
+{
+   int n = (span[0].len < ct) ? span[0].len : ct;
+   const uint8_t *src = span[0].ptr;
+
+   for( ; n >= 2; n -= 2, ct -= 2, src += 2 )
+      *dst++ = src[0] | (src[1]<<8);
+
+   // Odd byte left at the end of the first span
+   uint16_t lo = 0;
+   if( n )
+   {
+      lo = *src;
+      ct--;
+   }
+
+   src = span[1].ptr;
+   if( n && ct )
+   {
+      *dst++ = lo | (*src++ << 8);
+      ct--;
+   }
+   else if( n )
+      *dst = lo;
+
+   for( ; ct >= 2; ct -= 2, src += 2 )
+      *dst++ = src[0] | (src[1]<<8);
+
+   if( ct )
+      *dst = *src;
+}
+
+// Load as many packets from a port's transmit buffer into its IN
+// endpoint as it has room for.  Called from the interrupt or with
+// interrupts off.
+//
+// USB transfers end with a short packet, so once the buffer runs dry
+// after a full size packet a zero length packet is sent.  That isn't
+// done until the hardware has sent everything, which gives the
+// background a chance to queue more data first.
+static void FillTx( USBport *port )
+{
+   USB_Regs *usb = (USB_Regs *)USBFS_BASE;
+   USB_TblEntry *usbTbl = (USB_TblEntry *)USB_SRAM_BASE;
+   int N = port->inEP;
+
+   while( port->txPend < 2 )
+   {
+      BuffSpan span[2];
+      int ct = BuffGetSpans( port->tx, span );
+      if( ct > BULK_PKT_LEN )
+         ct = BULK_PKT_LEN;
+
+      if( !ct && (port->txPend || (port->txLast < BULK_PKT_LEN)) )
+         return;
+
+      // The software buffer flag tells me which of the two
+      // buffers I own.  The second uses the receive entries.
+      uint16_t ep = usb->endpoint[N];
+      uint16_t *dst;
+      if( ep & EP_SW_BUF_TX )
+      {
+         dst = (uint16_t *)(USB_SRAM_BASE + usbTbl[N].rxAddr);
+         usbTbl[N].rxCount = ct;
+      }
+      else
+      {
+         dst = (uint16_t *)(USB_SRAM_BASE + usbTbl[N].txAddr);
+         usbTbl[N].txCount = ct;
+      }
+
+      CopyToPMA( dst, span, ct );
+      BuffGetDone( port->tx, ct );
+
+      // Toggle the software buffer flag to pass this buffer
+      // to the hardware
+      usb->endpoint[N] = (ep & 0x070F) | 0x8080 | EP_SW_BUF_TX;
+
+      port->txLast = ct;
+      port->txPend++;
    }
 }
 
@@ -609,6 +852,24 @@ static void HandleXmit( int N )
    USB_Regs *usb = (USB_Regs *)USBFS_BASE;
    ClearEpStat( N, 0x0080 );
 
+   // A packet finished on one of the bulk IN endpoints.  If the buffer
+   // flags match the hardware is idle, otherwise one packet is still
+   // loaded.  Both packets may have been sent before I got here.
+   for( int i=0; i<USB_NUM_PORTS; i++ )
+   {
+      USBport *port = &ports[i];
+      if( port->inEP != N )
+         continue;
+
+      uint16_t ep = usb->endpoint[N];
+      if( (port->txPend == 2) && ((ep ^ (ep>>8)) & EP_DTOG_TX) )
+         port->txPend = 1;
+      else
+         port->txPend = 0;
+      FillTx( port );
+      return;
+   }
+
    if( epInfo[N].data )
       SendEP( N );
 
@@ -655,3 +916,15 @@ static int InitTblEntry( int N, int offset, int txLen, int rxLen )
    return offset + txLen + rxLen;
 }
 
+// Set up the buffer table for a double buffered transmit endpoint.
+// The receive entries are used for the second transmit buffer.
+static int InitDblTxEntry( int N, int offset, int txLen )
+{
+   USB_TblEntry *usbTbl = (USB_TblEntry *)USB_SRAM_BASE;
+   usbTbl[N].txAddr  = offset;
+   usbTbl[N].rxAddr  = offset+txLen;
+   usbTbl[N].txCount = 0;
+   usbTbl[N].rxCount = 0;
+   return offset + 2*txLen;
+}
+
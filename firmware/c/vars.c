@@ -2,6 +2,7 @@
 
 #include "binary.h"
 #include "errors.h"
+#include "string.h"
 #include "trace.h"
 #include "utils.h"
 #include "vars.h"
@@ -9,9 +10,13 @@
 // Variables are the main way to read/write data from the sensor.
 
 // prototypes
-static int VarGetUnknown( VarInfo *info, uint8_t *buff, int len );
-static int VarSetUnknown( VarInfo *info, uint8_t *buff, int len );
-static int VarSetReadOnly( VarInfo *info, uint8_t *buff, int len );
+static int VarGetUnknown( VarInfo *info, uint8_t *buff, int off, int len );
+static int VarSetUnknown( VarInfo *info, uint8_t *buff, int off, int len );
+static int VarSetReadOnly( VarInfo *info, uint8_t *buff, int off, int len );
+static VarInfo *FindVar( uint8_t *cmd );
+static int CheckRange( VarInfo *info, int off, int len );
+static int VarDescribe( VarInfo *info, uint8_t *buff, int max );
+static uint32_t RegistryHash( void );
 
 // local data
 static VarInfo *varList[ VARID_MAX ];
@@ -40,6 +45,8 @@ int VarInit( VarInfo *info, uint16_t id, const char *name, int type, void *ptr,
    info->id    = id;
    info->ptr   = ptr;
    info->flags = flags;
+   info->type  = type;
+   info->units = 0;
 
    switch( type )
    {
@@ -69,6 +76,46 @@ int VarInit( VarInfo *info, uint16_t id, const char *name, int type, void *ptr,
    return ERR_OK;
 }
 
+// Initialize an array variable.
+// This works just like VarInit, but count gives the number of 
+// elements in the array.  The type should be one of the array
+// types, the element size is based on that.
+//
+// Returns an error code or 0 on success
+int VarInitAry( VarInfo *info, uint16_t id, const char *name, int type, void *ptr, uint16_t count, uint8_t flags )
+{
+   int err = VarInit( info, id, name, type, ptr, flags );
+   if( err ) return err;
+
+   int elem = VarElemSize( info );
+   if( !elem || (count > 0xFFFF/elem) )
+      return ERR_RANGE;
+
+   info->get  = VarGetAry;
+   info->set  = (flags & VAR_FLG_READONLY) ? VarSetReadOnly : VarSetAry;
+   info->size = count * elem;
+   return ERR_OK;
+}
+
+// Return the size of a single element of the variable in bytes.
+// For arrays this is the size of one array entry, for other 
+// types it's the whole variable.
+int VarElemSize( VarInfo *info )
+{
+   switch( info->type )
+   {
+      case VAR_TYPE_ARY16:
+         return sizeof(uint16_t);
+
+      case VAR_TYPE_ARY32:
+      case VAR_TYPE_ARYFLT:
+         return sizeof(uint32_t);
+
+      default:
+         return info->size;
+   }
+}
+
 // This is called when a binary get command is received
 // The command will contain the following bytes:
 //   <cmd>   - The command code for a get command
@@ -86,18 +133,17 @@ int HandleVarGet( uint8_t *cmd, int len, int max )
    if( len < 4 )
       return ReturnErr( cmd, ERR_MISSING_DATA );
 
-   uint16_t vid = b2u16( &cmd[2] );
-   if( (vid >= VARID_MAX) || !(varList[vid]) )
+   VarInfo *info = FindVar( cmd );
+   if( !info )
       return ReturnErr( cmd, ERR_UNKNOWN_VAR );
 
-   VarInfo *info = varList[vid];
-
    // Make sure the buffer is long enough to hold the
-   // variable data and two byte header
+   // variable data and two byte header.  Large arrays
+   // need to be read using the partial get command.
    if( max < info->size+2 )
       return ReturnErr( cmd, ERR_SHORT_CMD );
 
-   int err = info->get( info, &cmd[2], max-2 );
+   int err = info->get( info, &cmd[2], 0, info->size );
    if( err )
       return ReturnErr( cmd, err );
 
@@ -117,25 +163,249 @@ int HandleVarSet( uint8_t *cmd, int len, int max )
    if( len < 4 )
       return ReturnErr( cmd, ERR_MISSING_DATA );
 
-   uint16_t vid = b2u16( &cmd[2] );
-   if( (vid >= VARID_MAX) || !(varList[vid]) )
+   VarInfo *info = FindVar( cmd );
+   if( !info )
       return ReturnErr( cmd, ERR_UNKNOWN_VAR );
 
-   VarInfo *info = varList[vid];
-
    // Make sure enough data was passed for this variable
    if( len < info->size+4 )
       return ReturnErr( cmd, ERR_MISSING_DATA );
 
-   int err = info->set( info, &cmd[4], len-4 );
+   int err = info->set( info, &cmd[4], 0, info->size );
+   return ReturnErr( cmd, err );
+}
+
+// This is called when a binary partial get command is received.
+// It's used to read part of an array variable, which is the only
+// way to read arrays that are larger then the command buffer.
+// The command will contain the following bytes:
+//   <cmd>   - The command code for a partial get command
+//   <cksum> - Checksum byte.  Already validated when this is called
+//   <varid> - Variable ID (2 bytes)
+//   <off>   - Byte offset of the first byte to read (2 bytes)
+//   <ct>    - Number of bytes to read (2 bytes)
+//
+// The offset and count must be multiples of the array element size.
+// If the count is larger then will fit in the response it's reduced.
+//
+// The response will be of the form:
+//   <err>   - Error code
+//   <cksum> - Checksum
+//   <...>   - Variable data
+int HandleVarGetPart( uint8_t *cmd, int len, int max )
+{
+   if( len < 8 )
+      return ReturnErr( cmd, ERR_MISSING_DATA );
+
+   VarInfo *info = FindVar( cmd );
+   if( !info )
+      return ReturnErr( cmd, ERR_UNKNOWN_VAR );
+
+   int off = b2u16( &cmd[4] );
+   int ct  = b2u16( &cmd[6] );
+
+   // Limit the number of bytes based on buffer size.
+   // I keep this a multiple of the element size.
+   int elem = VarElemSize( info );
+   if( ct > max-2 )
+   {
+      ct = max-2;
+      if( elem ) ct -= ct % elem;
+   }
+
+   int err = CheckRange( info, off, ct );
+   if( !err )
+      err = info->get( info, &cmd[2], off, ct );
+
+   if( err )
+      return ReturnErr( cmd, err );
+
+   return AddCksum( cmd, ct );
+}
+
+// This is called when a binary partial set command is received.
+// The command will contain the following bytes:
+//   <cmd>   - The command code for a partial set command
+//   <cksum> - Checksum byte.  Already validated when this is called
+//   <varid> - Variable ID (2 bytes)
+//   <off>   - Byte offset of the first byte to write (2 bytes)
+//   <...>   - The remaining bytes are the data to write
+int HandleVarSetPart( uint8_t *cmd, int len, int max )
+{
+   if( len < 7 )
+      return ReturnErr( cmd, ERR_MISSING_DATA );
+
+   VarInfo *info = FindVar( cmd );
+   if( !info )
+      return ReturnErr( cmd, ERR_UNKNOWN_VAR );
+
+   int off = b2u16( &cmd[4] );
+   int ct  = len-6;
+
+   int err = CheckRange( info, off, ct );
+   if( !err )
+      err = info->set( info, &cmd[6], off, ct );
+
    return ReturnErr( cmd, err );
 }
 
+// Find the variable whose ID is in a binary command
+// Returns null if the ID isn't valid
+static VarInfo *FindVar( uint8_t *cmd )
+{
+   uint16_t vid = b2u16( &cmd[2] );
+   if( vid >= VARID_MAX )
+      return 0;
+   return varList[vid];
+}
+
+// Make sure the offset and length passed to a partial get or 
+// set fall within the variable and are aligned to its elements.
+static int CheckRange( VarInfo *info, int off, int len )
+{
+   int elem = VarElemSize( info );
+   if( !elem )
+      return ERR_UNKNOWN_TYPE;
+
+   if( (len < 1) || (off+len > info->size) )
+      return ERR_RANGE;
+
+   if( (off % elem) || (len % elem) )
+      return ERR_RANGE;
+
+   return ERR_OK;
+}
+
+// This is called when a binary list command is received.
+// The host uses this to discover which variables the firmware supports
+// rather then keeping its own hard coded table.  Since the whole list
+// won't fit in one response, the host passes the first variable ID
+// it wants described and keeps asking until there are no more.
+//
+// The command will contain the following bytes:
+//   <cmd>   - The command code for a list command
+//   <cksum> - Checksum byte.  Already validated when this is called
+//   <varid> - First variable ID to describe (low byte)
+//   <varid> - First variable ID to describe (high byte)
+//
+// The response will be of the form:
+//   <err>   - Error code
+//   <cksum> - Checksum
+//   <hash>  - 32-bit hash of the entire variable registry.  The host can
+//             use this to cache the list between connections.
+//   <next>  - 16-bit ID to pass in the next list command, or 0xFFFF when
+//             there are no more variables to describe.
+//   <...>   - As many variable descriptions as will fit.  Each one is:
+//               <id>    - 16-bit variable ID
+//               <type>  - Variable type (VAR_TYPE_xxx)
+//               <flags> - Variable flags (VAR_FLG_xxx)
+//               <size>  - 16-bit size of the variable data in bytes
+//               <nlen>  - Length of the name, followed by the name itself
+//               <ulen>  - Length of the units, followed by the units
+int HandleVarList( uint8_t *cmd, int len, int max )
+{
+   if( len < 4 )
+      return ReturnErr( cmd, ERR_MISSING_DATA );
+
+   uint16_t vid = b2u16( &cmd[2] );
+
+   u32_2_u8( RegistryHash(), &cmd[2] );
+
+   // Add as many variable descriptions as will fit in the buffer
+   int ct = 6;
+   for( ; vid < VARID_MAX; vid++ )
+   {
+      if( !varList[vid] )
+         continue;
+
+      int n = VarDescribe( varList[vid], &cmd[2+ct], max-2-ct );
+      if( !n ) break;
+      ct += n;
+   }
+
+   if( vid >= VARID_MAX )
+      vid = 0xFFFF;
+
+   // If I couldn't fit even one description then the buffer
+   // is too short to be useful.
+   else if( ct == 6 )
+      return ReturnErr( cmd, ERR_SHORT_CMD );
+
+   u16_2_u8( vid, &cmd[6] );
+   return AddCksum( cmd, ct );
+}
+
+// Write the description of a single variable to the buffer 
+// in the format used by the list command.
+// Returns the number of bytes written, or 0 if it doesn't fit.
+static int VarDescribe( VarInfo *info, uint8_t *buff, int max )
+{
+   int nlen = strlen( info->name );
+   int ulen = info->units ? strlen( info->units ) : 0;
+   if( nlen > 255 ) nlen = 255;
+   if( ulen > 255 ) ulen = 255;
+
+   int tot = 8 + nlen + ulen;
+   if( tot > max )
+      return 0;
+
+   u16_2_u8( info->id, &buff[0] );
+   buff[2] = info->type;
+   buff[3] = info->flags;
+   u16_2_u8( info->size, &buff[4] );
+
+   buff[6] = nlen;
+   memcpy( &buff[7], info->name, nlen );
+
+   buff[7+nlen] = ulen;
+   memcpy( &buff[8+nlen], info->units, ulen );
+   return tot;
+}
+
+// Find a 32-bit hash of everything reported by the list command.
+// This is a simple FNV-1a hash, I just need something that changes
+// whenever a variable is added, removed or altered.
+static uint32_t HashBytes( uint32_t hash, const uint8_t *dat, int len )
+{
+   for( int i=0; i<len; i++ )
+   {
+      hash ^= dat[i];
+      hash *= 16777619;
+   }
+   return hash;
+}
+
+static uint32_t RegistryHash( void )
+{
+   uint32_t hash = 2166136261u;
+
+   for( int i=0; i<VARID_MAX; i++ )
+   {
+      VarInfo *info = varList[i];
+      if( !info ) continue;
+
+      uint8_t hdr[6];
+      u16_2_u8( info->id, &hdr[0] );
+      hdr[2] = info->type;
+      hdr[3] = info->flags;
+      u16_2_u8( info->size, &hdr[4] );
+      hash = HashBytes( hash, hdr, sizeof(hdr) );
+
+      // I include the terminating null characters so that moving
+      // characters between the name and units changes the hash
+      hash = HashBytes( hash, (const uint8_t*)info->name, strlen(info->name)+1 );
+      if( info->units )
+         hash = HashBytes( hash, (const uint8_t*)info->units, strlen(info->units)+1 );
+   }
+
+   return hash;
+}
+
 // Standard functions to get a 16 bit signed or unsigned variable
-int VarGet16( VarInfo *info, uint8_t *buff, int max )
+int VarGet16( VarInfo *info, uint8_t *buff, int off, int len )
 {
    // Make sure there's at least two bytes of space in the passed buffer
-   if( max < sizeof(int16_t) )
+   if( len < sizeof(int16_t) )
       return ERR_MISSING_DATA;
 
    uint16_t val = *(uint16_t*)info->ptr;
@@ -144,10 +414,10 @@ int VarGet16( VarInfo *info, uint8_t *buff, int max )
 }
 
 // Standard functions to get a 32 bit signed or unsigned variable
-int VarGet32( VarInfo *info, uint8_t *buff, int max )
+int VarGet32( VarInfo *info, uint8_t *buff, int off, int len )
 {
    // Make sure there's at least two bytes of space in the passed buffer
-   if( max < sizeof(int32_t) )
+   if( len < sizeof(int32_t) )
       return ERR_MISSING_DATA;
 
    uint32_t val = *(uint32_t*)info->ptr;
@@ -156,7 +426,7 @@ int VarGet32( VarInfo *info, uint8_t *buff, int max )
 }
 
 // Standard functions to set a 16 bit signed or unsigned variable
-int VarSet16( VarInfo *info, uint8_t *buff, int len )
+int VarSet16( VarInfo *info, uint8_t *buff, int off, int len )
 {
    // Make sure enough data was passed
    if( len < sizeof(int16_t) )
@@ -169,7 +439,7 @@ int VarSet16( VarInfo *info, uint8_t *buff, int len )
 }
 
 // Standard functions to set a 32 bit signed or unsigned variable
-int VarSet32( VarInfo *info, uint8_t *buff, int len )
+int VarSet32( VarInfo *info, uint8_t *buff, int off, int len )
 {
    // Make sure enough data was passed
    if( len < sizeof(int32_t) )
@@ -181,8 +451,24 @@ int VarSet32( VarInfo *info, uint8_t *buff, int len )
    return ERR_OK;
 }
 
+// Standard function to get part of an array variable.
+// The array data is stored little endian in memory just like 
+// the binary protocol, so this is just a copy.
+int VarGetAry( VarInfo *info, uint8_t *buff, int off, int len )
+{
+   memcpy( buff, (uint8_t*)info->ptr + off, len );
+   return ERR_OK;
+}
+
+// Standard function to set part of an array variable.
+int VarSetAry( VarInfo *info, uint8_t *buff, int off, int len )
+{
+   memcpy( (uint8_t*)info->ptr + off, buff, len );
+   return ERR_OK;
+}
+
 // Default functions if the type of variable passed to VarInit
 // was not known.
-static int VarGetUnknown( VarInfo *info, uint8_t *buff, int len ){ return ERR_UNKNOWN_TYPE; }
-static int VarSetUnknown( VarInfo *info, uint8_t *buff, int len ){ return ERR_UNKNOWN_TYPE; }
-static int VarSetReadOnly( VarInfo *info, uint8_t *buff, int len ){ return ERR_READ_ONLY; }
+static int VarGetUnknown( VarInfo *info, uint8_t *buff, int off, int len ){ return ERR_UNKNOWN_TYPE; }
+static int VarSetUnknown( VarInfo *info, uint8_t *buff, int off, int len ){ return ERR_UNKNOWN_TYPE; }
+static int VarSetReadOnly( VarInfo *info, uint8_t *buff, int off, int len ){ return ERR_READ_ONLY; }
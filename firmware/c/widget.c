@@ -0,0 +1,87 @@
+/* widget.c */
+
+// Retained mode screen layout.
+//
+// A screen is a list of widgets, each owning a rectangle of the
+// display.  The display buffer keeps what was drawn last time, so a
+// widget only needs to be drawn again when what it shows changes.
+// Number widgets keep the integer they last displayed and are
+// redrawn when the new value would display differently, so noise
+// below the display resolution costs nothing.  They're drawn with
+// DrawNumber, which overwrites the whole field from cached glyphs
+// without any formatting or clearing first.  Custom widgets such
+// as graphs report a state value, for example the sequence number
+// of their newest sample, and are redrawn when it changes.
+//
+// When nothing on the screen has changed no frame is sent at all.
+
+#include "display.h"
+#include "widget.h"
+
+// Mark all the widgets in a list to be drawn on the next update.
+// Used when a screen is first shown.
+void WidgetInvalidate( Widget *list, int ct )
+{
+   for( int i=0; i<ct; i++ )
+      list[i].valid = 0;
+}
+
+// Find the value a widget would show now
+static int32_t WidgetValue( const Widget *w )
+{
+   switch( w->type )
+   {
+      case WIDGET_TYPE_NUMBER:
+         return (int32_t)(w->get() * w->scale);
+
+      case WIDGET_TYPE_CUSTOM:
+         return w->state ? w->state() : 0;
+
+      default:
+         return 0;
+   }
+}
+
+// Redraw any widgets in the list that have changed.
+// Returns the number of widgets drawn.
+int WidgetUpdate( Widget *list, int ct )
+{
+   int drawn = 0;
+
+   for( int i=0; i<ct; i++ )
+   {
+      Widget *w = &list[i];
+
+      int32_t val = WidgetValue( w );
+      if( w->valid && (val == w->shown) )
+         continue;
+
+      w->shown = val;
+      w->valid = 1;
+      drawn++;
+
+      SetFont( w->font );
+
+      if( w->type == WIDGET_TYPE_NUMBER )
+      {
+         DrawNumber( val, w->dec, w->digits, w->x, w->y );
+         continue;
+      }
+
+      int h = w->h ? w->h : CrntFont()->yAdv;
+      FillRect( w->x, w->y, w->w, h, DRAW_CLEAR );
+
+      switch( w->type )
+      {
+         case WIDGET_TYPE_TEXT:
+            DrawString( w->text, w->x, w->y );
+            break;
+
+         case WIDGET_TYPE_CUSTOM:
+            w->draw( w );
+            break;
+      }
+   }
+
+   return drawn;
+}
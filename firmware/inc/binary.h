@@ -20,9 +20,15 @@
 #define CMD_ERASE_FW          6
 #define CMD_WRITE_FW          7
 #define OP_SAVE_FWCRC         8
+#define CMD_LIST_VARS         9
+#define CMD_GET_PART          10
+#define CMD_SET_PART          11
+#define CMD_SET_PROTO         12
+#define CMD_READ_BULK         13
 
 // prototypes
 int ProcessBinaryCmd( uint8_t *cmd, int ct, int max );
+int DispatchBinaryCmd( uint8_t *cmd, int ct, int max );
 
 // Use this function to return a successful command response.
 // It adds the 0 error code and checksum.
@@ -1,86 +1,175 @@
 /* buffer.h */
 
+// Circular buffer used to pass data between a single producer and a
+// single consumer, for example an interrupt handler and the background
+// task.  The head is only ever written by the producer and the tail only
+// by the consumer, so no locking is needed.
+//
+// The buffer size must be a power of 2.  The head and tail are free
+// running counts which are masked to index the buffer, so every byte
+// of the buffer can be used and a full buffer is never mistaken for
+// an empty one.  Sizes up to 32k are supported.
+//
+// Data and free space can be accessed in place through spans.  Since
+// the buffer wraps there can be up to two of them; the single span
+// functions just return the first.
+
 #ifndef _DEF_INC_BUFFER
 #define _DEF_INC_BUFFER
 
 #include <stdint.h>
-#include "trace.h"
+#include "string.h"
 
 typedef struct
 {
-   uint8_t head, tail;
-   uint8_t buff[128];
+   volatile uint16_t head;   // Total bytes added.  Only written by the producer.
+   volatile uint16_t tail;   // Total bytes removed.  Only written by the consumer.
+   uint16_t size;
+   uint8_t *buff;
 } CircBuff;
 
-static inline int BuffUsed( CircBuff *cb )
+// A contiguous block of data or free space in a buffer
+typedef struct
 {
-   int h = cb->head;
-   int t = cb->tail;
+   uint8_t *ptr;
+   int len;
+} BuffSpan;
+
+// Define a buffer along with the memory it uses
+#define CIRC_BUFF( name, sz )                                              \
+   _Static_assert( !((sz) & ((sz)-1)) && ((sz) <= 0x8000), "Bad size" );  \
+   static uint8_t name##Data[sz];                                         \
+   static CircBuff name = { 0, 0, (sz), name##Data }
+
+// The buffer data must be written before the head that makes it visible
+// to the consumer is updated.  Likewise the consumer must finish with the
+// data before updating the tail that lets the producer reuse it.
+static inline void BuffBarrier( void )
+{
+   asm volatile( "dmb" ::: "memory" );
+}
 
-   int ct = h-t;
-   if( ct < 0 ) ct += sizeof(cb->buff);
-   return ct;
+static inline int BuffUsed( CircBuff *cb )
+{
+   return (uint16_t)(cb->head - cb->tail);
 }
 
 static inline int BuffFree( CircBuff *cb )
 {
-   return sizeof(cb->buff) - 1 - BuffUsed( cb );
+   return cb->size - BuffUsed( cb );
 }
 
-static inline int BuffAddByte( CircBuff *cb, uint8_t dat )
+// Split count bytes starting at index ndx into at most two
+// contiguous spans.  Returns count.
+static inline int BuffSplit( CircBuff *cb, uint16_t ndx, int count, BuffSpan span[2] )
 {
-   uint8_t newHead = cb->head + 1;
-   if( newHead >= sizeof(cb->buff) ) 
-      newHead = 0;
+   int off = ndx & (cb->size-1);
+   int first = cb->size - off;
+   if( first > count )
+      first = count;
+
+   span[0].ptr = &cb->buff[off];
+   span[0].len = first;
+   span[1].ptr = cb->buff;
+   span[1].len = count - first;
+   return count;
+}
 
-   if( newHead == cb->tail )
-      return 0;
+// Find the data waiting to be read from the buffer.
+// Returns the total number of bytes.  Call BuffGetDone
+// once the data has been used.
+static inline int BuffGetSpans( CircBuff *cb, BuffSpan span[2] )
+{
+   uint16_t t = cb->tail;
+   int ct = (uint16_t)(cb->head - t);
+   BuffBarrier();
+   return BuffSplit( cb, t, ct, span );
+}
 
-   cb->buff[ cb->head ] = dat;
-   cb->head = newHead;
-   return 1;
+// Find the free space in the buffer.  Returns the total number of
+// free bytes.  Data can be written directly here and then added to
+// the buffer by calling BuffAddDone.
+static inline int BuffAddSpans( CircBuff *cb, BuffSpan span[2] )
+{
+   uint16_t h = cb->head;
+   int ct = cb->size - (uint16_t)(h - cb->tail);
+   return BuffSplit( cb, h, ct, span );
 }
 
-static inline int BuffAdd( CircBuff *cb, uint8_t *dat, int ct )
+// Find the first contiguous block of data waiting to be read.
+// A pointer to the first byte is returned through ptr and the number
+// of bytes in the block is returned.  This may be less then the total
+// bytes used if the data wraps around the end of the buffer.
+static inline int BuffGetSpan( CircBuff *cb, uint8_t **ptr )
 {
-   int tot = BuffFree( cb );
-   if( tot > ct ) tot = ct;
+   BuffSpan span[2];
+   BuffGetSpans( cb, span );
+   *ptr = span[0].ptr;
+   return span[0].len;
+}
 
-   for( int i=0; i<tot; i++ )
-   {
-      cb->buff[ cb->head++ ] = dat[i];
-      if( cb->head >= sizeof(cb->buff) )
-         cb->head = 0;
-   }
+// Find the first contiguous block of free space in the buffer.
+static inline int BuffAddSpan( CircBuff *cb, uint8_t **ptr )
+{
+   BuffSpan span[2];
+   BuffAddSpans( cb, span );
+   *ptr = span[0].ptr;
+   return span[0].len;
+}
 
-   return tot;
+// Remove ct bytes from the buffer after reading them through a span
+static inline void BuffGetDone( CircBuff *cb, int ct )
+{
+   BuffBarrier();
+   cb->tail += ct;
 }
 
-static inline int BuffGetByte( CircBuff *cb )
+// Add ct bytes written through a span to the buffer
+static inline void BuffAddDone( CircBuff *cb, int ct )
 {
-   if( cb->head == cb->tail )
-      return -1;
+   BuffBarrier();
+   cb->head += ct;
+}
 
-   int ret = cb->buff[ cb->tail++ ];
-   if( cb->tail >= sizeof(cb->buff) )
-      cb->tail = 0;
+static inline int BuffAdd( CircBuff *cb, const uint8_t *dat, int ct )
+{
+   BuffSpan span[2];
+   int tot = BuffAddSpans( cb, span );
+   if( tot > ct ) tot = ct;
+
+   int n = (span[0].len < tot) ? span[0].len : tot;
+   memcpy( span[0].ptr, dat, n );
+   memcpy( span[1].ptr, &dat[n], tot-n );
 
-   return ret;
+   BuffAddDone( cb, tot );
+   return tot;
 }
 
 static inline int BuffGet( CircBuff *cb, uint8_t *dat, int max )
 {
-   int tot = BuffUsed( cb );
+   BuffSpan span[2];
+   int tot = BuffGetSpans( cb, span );
    if( tot > max ) tot = max;
 
-   for( int i=0; i<tot; i++ )
-   {
-      dat[i] = cb->buff[ cb->tail++ ];
-      if( cb->tail >= sizeof(cb->buff) )
-         cb->tail = 0;
-   }
+   int n = (span[0].len < tot) ? span[0].len : tot;
+   memcpy( dat, span[0].ptr, n );
+   memcpy( &dat[n], span[1].ptr, tot-n );
+
+   BuffGetDone( cb, tot );
    return tot;
 }
 
+static inline int BuffAddByte( CircBuff *cb, uint8_t dat )
+{
+   return BuffAdd( cb, &dat, 1 );
+}
+
+static inline int BuffGetByte( CircBuff *cb )
+{
+   uint8_t dat;
+   if( !BuffGet( cb, &dat, 1 ) )
+      return -1;
+   return dat;
+}
 
 #endif
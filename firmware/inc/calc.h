@@ -5,6 +5,16 @@
 
 #include <stdint.h>
 
+// Most points kept for each breath of the PV loop
+#define PV_MAX_POINTS       256
+
+// One point of the PV loop
+typedef struct
+{
+   int16_t pres;        // Pressure in 0.1 cmH2O units
+   int16_t vol;         // Volume in 0.1 ml units
+} PVPoint;
+
 // prototypes
 void UpdateCalculations( void );
 float GetTV( void );
@@ -12,6 +22,11 @@ float GetPIP( void );
 float GetPEEP( void );
 float GetPresHistory( uint8_t ndx );
 float GetFlowHistory( uint8_t ndx );
+uint32_t GetHistSeq( void );
+float GetPresHistAt( uint32_t seq );
+float GetFlowHistAt( uint32_t seq );
+uint32_t GetBreathCount( void );
+const PVPoint *GetPVPoints( int prev, int *ct );
 float GetPresAvg( uint16_t ms );
 float GetFlowAvg( uint16_t ms );
 
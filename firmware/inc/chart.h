@@ -0,0 +1,33 @@
+/* chart.h */
+
+#ifndef _DEF_INC_CHART
+#define _DEF_INC_CHART
+
+#include <stdint.h>
+#include "display.h"
+
+// Function used by a chart to read a history sample by sequence number
+typedef float (*ChartGet)( uint32_t seq );
+
+// Scrolling strip chart.
+// The rendered columns are kept in a ring, so each new sample only
+// costs drawing one column.  The chart covers the full width of the
+// display and a whole number of pages at the bottom of it.
+typedef struct
+{
+   ChartGet get;              // Function that reads the samples
+   float min;                 // Value drawn at the bottom of the chart
+   float max;                 // Value drawn at the top of the chart
+   uint8_t page;              // First display page used by the chart
+   uint8_t fill;              // Set to fill the area under the trace
+   uint8_t head;              // Ring column holding the newest sample
+   int8_t lastY;              // Row of the newest sample within the chart
+   uint32_t seq;              // Sequence number of the newest sample drawn
+   uint8_t ring[ DISP_PAGES ][ DISP_COLS ];
+} StripChart;
+
+// prototypes
+void ChartSetup( StripChart *chart, ChartGet get, float min, float max, int y, int fill );
+void ChartDraw( StripChart *chart, uint32_t seq );
+
+#endif
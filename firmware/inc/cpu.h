@@ -20,12 +20,15 @@
 // vector table divided by 4
 // The interrupt vector table can be found in the reference manual 
 // in the section on the NVIC (12)
+#define INT_VECT_DMA1_4    0x78/4
+#define INT_VECT_DMA1_5    0x7C/4
 #define INT_VECT_DMA1_6    0x80/4
 #define INT_VECT_TMR15     0xA0/4
 #define INT_VECT_TMR16     0xA4/4
 #define INT_VECT_SPI1      0xCC/4
 #define INT_VECT_UART1     0xD4/4
 #define INT_VECT_I2C1      0xBC/4
+#define INT_VECT_USB       0x14C/4
 
 typedef volatile uint64_t LREG;
 typedef volatile uint32_t REG;
@@ -121,6 +124,19 @@ typedef struct
    } pull[6];
 } PwrCtrl_Reg;
 
+// System configuration controller
+#define SYSCFG_BASE                 0x40010000
+typedef struct
+{
+   REG memRemap;                 // 0x00 memory remap register (SYSCFG_MEMRMP)
+   REG cfg1;                     // 0x04 configuration register 1 (SYSCFG_CFGR1)
+   REG extIntCfg[4];             // 0x08 external interrupt configuration registers (SYSCFG_EXTICRn)
+   REG sramCtrl;                 // 0x18 SRAM2 control and status register (SYSCFG_SCSR)
+   REG cfg2;                     // 0x1C configuration register 2 (SYSCFG_CFGR2)
+   REG sramProt;                 // 0x20 SRAM2 write protection register (SYSCFG_SWPR)
+   REG sramKey;                  // 0x24 SRAM2 key register (SYSCFG_SKR)
+} SysCfg_Regs;
+
 // Digital I/O
 #define DIGIO_A_BASE                0x48000000
 #define DIGIO_B_BASE                0x48000400
@@ -422,6 +438,7 @@ static inline void GPIO_PullDn( uint32_t bank, int pin )
 // Prototypes
 void CPU_Init( void );
 void EnableInterrupt( int id, int pri );
+void PendInterrupt( int id );
 void Reset( void );
 void SwapMode( void );
 int CheckSwap( void );
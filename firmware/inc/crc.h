@@ -0,0 +1,15 @@
+/* crc.h */
+
+#ifndef _DEF_INC_CRC
+#define _DEF_INC_CRC
+
+#include <stdint.h>
+
+// Starting value for a CRC calculation
+#define CRC32_INIT       0xFFFFFFFF
+
+// prototypes
+uint32_t CalcCRC32( const uint8_t *dat, int len );
+uint32_t UpdateCRC32( uint32_t crc, const uint8_t *dat, int len );
+
+#endif
@@ -8,6 +8,17 @@
 #define FONT_FREESANS_20       0
 #define FONT_FREESANS_16       1
 #define FONT_FREESANS_12       2
+#define FONT_BIG_DIGITS        3       // Just - . / and 0 to 9
+
+// Display size in pixels.  Rows are grouped into pages of 8.
+#define DISP_COLS              128
+#define DISP_ROWS              64
+#define DISP_PAGES             (DISP_ROWS/8)
+
+// Drawing operations
+#define DRAW_CLEAR             0
+#define DRAW_SET               1
+#define DRAW_INVERT            2
 
 // Represents one character of a font
 typedef struct
@@ -26,8 +37,12 @@ typedef struct
    uint8_t yAdv;           // Y advance / row
    uint8_t firstChar;      // First character in font.  Normally 0x20, ASCII space
    uint8_t lastChar;       // Last character in font.  Normally 0x7E, ASCII ~
+   uint8_t flags;          // FONT_FLG_ values below
 } FontInfo;
 
+// Font flags
+#define FONT_FLG_RLE           0x01    // Bitmaps are compressed
+
 // prototypes
 void InitDisplay();
 void DispISR( void );
@@ -36,10 +51,17 @@ const FontInfo *GetFontInfo( uint8_t id );
 const FontInfo *CrntFont( void );
 int DrawChar( uint8_t ch, int x, int y );
 int DrawString( const char *str, int x, int y );
+int DrawNumber( int32_t val, int dec, int digits, int x, int y );
 void ClearDisplay( void );
-void FillRect( int x1, int y1, int w, int h, int color );
+void FillRect( int x1, int y1, int w, int h, int op );
+void HLine( int x, int y, int w, int op );
+void VLine( int x, int y, int h, int op );
+void DrawLine( int x1, int y1, int x2, int y2, int op );
+void DrawBitmap( const uint8_t *bm, int x, int y, int w, int h, int op );
 void SetPixel( int x, int y );
 void ClearPixel( int x, int y );
 void UpdateDisplay( void );
+void SetDrawTarget( uint8_t buff[][DISP_COLS] );
+int DisplayReady( void );
 
 #endif
@@ -0,0 +1,52 @@
+// Auto-generated font header
+// Input font file: /usr/share/fonts/truetype/dejavu/DejaVuSans-Bold.ttf
+// Font point size: 28
+// Compressed
+
+static const uint8_t bigdigits28_bitmap[] = {
+   0x09, 0x51, 0xc8, 0x0f, 0x51, 0x05, 0x49, 0xc4, 0xe0, 0xc4, 0x03, 0x44, 0x0a, 0x46, 0xc2, 0xc0, 
+   0x43, 0x04, 0xc0, 0xf8, 0xff, 0x3f, 0x07, 0x42, 0x04, 0xe0, 0xfc, 0xff, 0x1f, 0x01, 0x42, 0x03, 
+   0x18, 0x1f, 0x1f, 0x07, 0x4f, 0x11, 0x42, 0x01, 0x80, 0x80, 0xc6, 0xc0, 0x01, 0x80, 0x80, 0x42, 
+   0x01, 0xf0, 0xfc, 0x82, 0x01, 0x0f, 0x07, 0xc2, 0x03, 0x01, 0x07, 0x0f, 0x82, 0x03, 0xfc, 0xf0, 
+   0x0f, 0x3f, 0x82, 0x01, 0xf0, 0xe0, 0xc2, 0xc0, 0x01, 0xe0, 0xf0, 0x82, 0x01, 0x3f, 0x0f, 0x42, 
+   0x01, 0x01, 0x01, 0xc6, 0x03, 0x01, 0x01, 0x01, 0x53, 0x0f, 0x01, 0x80, 0x80, 0xc7, 0xc0, 0x44, 
+   0xc2, 0x07, 0x01, 0x03, 0x03, 0x84, 0x44, 0xc4, 0xc0, 0x84, 0xc4, 0xc0, 0xce, 0x03, 0x4e, 0x0f, 
+   0x01, 0x80, 0x80, 0xc8, 0xc0, 0x01, 0x80, 0x80, 0x41, 0x01, 0x07, 0x07, 0xc5, 0x03, 0x01, 0x83, 
+   0xc7, 0x83, 0x07, 0x7e, 0xc0, 0xe0, 0xf0, 0xf8, 0xfc, 0xfc, 0xfe, 0x81, 0x05, 0xdf, 0xcf, 0xc7, 
+   0xc3, 0xc1, 0xc0, 0xce, 0x03, 0x4e, 0x0f, 0x02, 0x00, 0x80, 0x80, 0xc7, 0xc0, 0x01, 0x80, 0x80, 
+   0x42, 0x02, 0x07, 0x07, 0x03, 0xc4, 0xc3, 0x09, 0xe7, 0xff, 0x7f, 0x7f, 0x3f, 0x1e, 0xe0, 0xe0, 
+   0xc0, 0xc0, 0xc4, 0xc3, 0x00, 0xe7, 0x82, 0x03, 0xfe, 0x7c, 0x01, 0x01, 0xc7, 0x03, 0xc2, 0x01, 
+   0x50, 0x11, 0x46, 0x00, 0x80, 0xc5, 0xc0, 0x44, 0x06, 0xc0, 0xe0, 0xf8, 0x7c, 0x3f, 0x0f, 0x07, 
+   0x84, 0x42, 0x00, 0x3e, 0xc2, 0x3f, 0x00, 0x3d, 0xc3, 0x3c, 0x84, 0xc2, 0x3c, 0x48, 0xc4, 0x03, 
+   0x53, 0x0f, 0x00, 0x00, 0xcc, 0xc0, 0x41, 0x83, 0xc5, 0xf3, 0x06, 0xe3, 0xe3, 0xc3, 0x00, 0xe0, 
+   0xe1, 0xc1, 0xc4, 0xc0, 0x01, 0xe1, 0xe1, 0x82, 0x03, 0x7f, 0x3f, 0x01, 0x01, 0xc7, 0x03, 0x01, 
+   0x01, 0x01, 0x51, 0x10, 0x43, 0x01, 0x80, 0x80, 0xc6, 0xc0, 0x05, 0x80, 0x80, 0x00, 0xf0, 0xfc, 
+   0xfe, 0x81, 0x01, 0xef, 0xe7, 0xc4, 0xf3, 0x05, 0xe3, 0xe7, 0xc7, 0x00, 0x0f, 0x7f, 0x82, 0x00, 
+   0xe1, 0xc3, 0xc0, 0x00, 0xe1, 0x82, 0x01, 0x7f, 0x3f, 0x42, 0x01, 0x01, 0x01, 0xc5, 0x03, 0x01, 
+   0x01, 0x01, 0x52, 0x0f, 0xce, 0xc0, 0xc5, 0x03, 0x02, 0x83, 0xe3, 0xfb, 0x82, 0x02, 0x3f, 0x0f, 
+   0x03, 0x42, 0x02, 0xc0, 0xf0, 0xfc, 0x81, 0x03, 0x7f, 0x1f, 0x07, 0x01, 0x44, 0xc4, 0x03, 0x00, 
+   0x01, 0x55, 0x10, 0x42, 0x00, 0x80, 0xc7, 0xc0, 0x00, 0x80, 0x43, 0x01, 0x3e, 0x7f, 0x82, 0x03, 
+   0xe7, 0xc3, 0xc3, 0xe7, 0x82, 0x05, 0x7f, 0x3e, 0x00, 0x7c, 0xfe, 0xfe, 0x81, 0x00, 0xe7, 0xc3, 
+   0xc3, 0x00, 0xe7, 0x81, 0x02, 0xfe, 0xfe, 0x7c, 0x41, 0x01, 0x01, 0x01, 0xc7, 0x03, 0x01, 0x01, 
+   0x01, 0x51, 0x10, 0x42, 0x01, 0x80, 0x80, 0xc5, 0xc0, 0x01, 0x80, 0x80, 0x42, 0x01, 0xfc, 0xfe, 
+   0x82, 0x00, 0x87, 0xc3, 0x03, 0x00, 0x87, 0x82, 0x05, 0xfe, 0xf0, 0x00, 0xe3, 0xc7, 0xc7, 0xc4, 
+   0xcf, 0x01, 0xe7, 0xf7, 0x81, 0x04, 0x7f, 0x3f, 0x07, 0x00, 0x01, 0xc7, 0x03, 0x01, 0x01, 0x01, 
+   0x53 };
+
+static const FontChar bigdigits28_chars[] = {
+   {    0,  5,  2, 12 },      // '-'
+   {    5,  7,  3, 11 },      // '.'
+   {   12, 25,  0, 11 },      // '/'
+   {   37, 52,  1, 19 },      // '0'
+   {   89, 22,  3, 19 },      // '1'
+   {  111, 39,  2, 19 },      // '2'
+   {  150, 43,  2, 19 },      // '3'
+   {  193, 32,  1, 19 },      // '4'
+   {  225, 34,  2, 19 },      // '5'
+   {  259, 48,  2, 19 },      // '6'
+   {  307, 31,  2, 19 },      // '7'
+   {  338, 48,  2, 19 },      // '8'
+   {  386, 47,  2, 19 },      // '9'
+};
+
+static const FontInfo bigdigits28 = { bigdigits28_bitmap, bigdigits28_chars, 33, 45, 57, FONT_FLG_RLE };
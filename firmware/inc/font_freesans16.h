@@ -1,221 +1,189 @@
 // Auto-generated font header
 // Input font file: /usr/share/fonts/truetype/freefont/FreeSans.ttf
 // Font point size: 16
+// Compressed
 
 static const uint8_t freesans16_bitmap[] = {
-   0x00, 0x5f, 0xf8, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x08, 0x00, 0x00, 
-   0x48, 0x80, 0x00, 0x7f, 0x80, 0x00, 0x09, 0xf0, 0x00, 0x08, 0x80, 0x00, 0x7c, 0x80, 0x00, 0x0f, 
-   0xf0, 0x00, 0x08, 0x90, 0x00, 0x00, 0x80, 0x00, 0x31, 0xe0, 0x00, 0x61, 0x30, 0x00, 0x42, 0x10, 
-   0x00, 0xff, 0xf8, 0x00, 0x42, 0x10, 0x00, 0x64, 0x30, 0x00, 0x3c, 0x60, 0x00, 0x03, 0xc0, 0x00, 
-   0x06, 0x60, 0x00, 0x04, 0x20, 0x00, 0x04, 0x20, 0x00, 0xc6, 0x60, 0x00, 0x33, 0xc0, 0x00, 0x1c, 
-   0x00, 0x00, 0x07, 0x00, 0x00, 0x71, 0x80, 0x00, 0xd8, 0x60, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 
-   0x00, 0xd8, 0x00, 0x00, 0x70, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x66, 0xe0, 0x00, 0x43, 0x90, 0x00, 
-   0x47, 0x10, 0x00, 0x6d, 0x90, 0x00, 0x38, 0xe0, 0x00, 0x38, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x40, 
-   0x00, 0x00, 0x00, 0xf0, 0x00, 0x7f, 0x00, 0x03, 0x80, 0xe0, 0x04, 0x00, 0x10, 0x04, 0x00, 0x10, 
-   0x03, 0x80, 0xe0, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x38, 0x00, 
-   0x00, 0xe0, 0x00, 0x00, 0x10, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x7f, 
-   0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x04, 0x00, 
-   0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x40, 0x00, 0x00, 0x1e, 0x00, 0x00, 
-   0x01, 0xe0, 0x00, 0x00, 0x18, 0x00, 0x1f, 0xc0, 0x00, 0x20, 0x20, 0x00, 0x40, 0x10, 0x00, 0x40, 
-   0x10, 0x00, 0x40, 0x10, 0x00, 0x20, 0x20, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x60, 
-   0x00, 0x7f, 0xf0, 0x00, 0x60, 0x60, 0x00, 0x58, 0x30, 0x00, 0x4c, 0x10, 0x00, 0x44, 0x10, 0x00, 
-   0x46, 0x10, 0x00, 0x42, 0x30, 0x00, 0x41, 0xe0, 0x00, 0x30, 0x60, 0x00, 0x60, 0x30, 0x00, 0x40, 
-   0x10, 0x00, 0x42, 0x10, 0x00, 0x42, 0x10, 0x00, 0x67, 0x30, 0x00, 0x3d, 0xe0, 0x00, 0x0c, 0x00, 
-   0x00, 0x0e, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x08, 0xc0, 0x00, 0x08, 0x60, 0x00, 0x7f, 0xf0, 0x00, 
-   0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x33, 0x80, 0x00, 0x63, 0x70, 0x00, 0x41, 0x10, 0x00, 0x41, 
-   0x10, 0x00, 0x41, 0x10, 0x00, 0x23, 0x10, 0x00, 0x1e, 0x10, 0x00, 0x1f, 0xc0, 0x00, 0x22, 0x20, 
-   0x00, 0x41, 0x10, 0x00, 0x41, 0x10, 0x00, 0x41, 0x10, 0x00, 0x23, 0x20, 0x00, 0x1e, 0x40, 0x00, 
-   0x00, 0x10, 0x00, 0x60, 0x10, 0x00, 0x1c, 0x10, 0x00, 0x03, 0x10, 0x00, 0x00, 0x90, 0x00, 0x00, 
-   0x70, 0x00, 0x00, 0x10, 0x00, 0x3d, 0xe0, 0x00, 0x67, 0x30, 0x00, 0x42, 0x10, 0x00, 0x42, 0x10, 
-   0x00, 0x42, 0x10, 0x00, 0x67, 0x30, 0x00, 0x3d, 0xe0, 0x00, 0x23, 0xc0, 0x00, 0x66, 0x20, 0x00, 
-   0x44, 0x10, 0x00, 0x44, 0x10, 0x00, 0x44, 0x10, 0x00, 0x22, 0x20, 0x00, 0x1f, 0xc0, 0x00, 0x40, 
-   0x40, 0x01, 0xc0, 0x80, 0x00, 0x0c, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x16, 0x00, 0x00, 0x12, 0x00, 
-   0x00, 0x32, 0x00, 0x00, 0x21, 0x00, 0x00, 0x61, 0x00, 0x00, 0x41, 0x80, 0x00, 0x12, 0x00, 0x00, 
-   0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 
-   0x00, 0x00, 0x12, 0x00, 0x00, 0x61, 0x00, 0x00, 0x21, 0x00, 0x00, 0x23, 0x00, 0x00, 0x12, 0x00, 
-   0x00, 0x12, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x30, 0x00, 
-   0x00, 0x18, 0x00, 0x00, 0x08, 0x00, 0x4e, 0x08, 0x00, 0x03, 0x08, 0x00, 0x01, 0x98, 0x00, 0x00, 
-   0xf0, 0x00, 0x1f, 0x00, 0x00, 0x60, 0xc0, 0x00, 0xc0, 0x20, 0x00, 0x9e, 0x10, 0x01, 0x31, 0x10, 
-   0x01, 0x20, 0x88, 0x01, 0x20, 0x88, 0x01, 0x10, 0x88, 0x01, 0x3f, 0x08, 0x01, 0x27, 0x98, 0x00, 
-   0x21, 0x90, 0x00, 0x30, 0x30, 0x00, 0x18, 0x60, 0x00, 0x0f, 0x80, 0x00, 0x40, 0x00, 0x00, 0x78, 
-   0x00, 0x00, 0x1f, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x04, 0x78, 0x00, 0x04, 0x18, 0x00, 0x04, 0xf0, 
-   0x00, 0x07, 0xc0, 0x00, 0x3e, 0x00, 0x00, 0x70, 0x00, 0x00, 0x7f, 0xf8, 0x00, 0x42, 0x08, 0x00, 
-   0x42, 0x08, 0x00, 0x42, 0x08, 0x00, 0x42, 0x08, 0x00, 0x42, 0x08, 0x00, 0x43, 0x18, 0x00, 0x65, 
-   0xf0, 0x00, 0x3c, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x30, 0x30, 0x00, 0x20, 0x10, 0x00, 0x40, 0x08, 
-   0x00, 0x40, 0x08, 0x00, 0x40, 0x08, 0x00, 0x40, 0x08, 0x00, 0x20, 0x10, 0x00, 0x18, 0x20, 0x00, 
-   0x7f, 0xf8, 0x00, 0x40, 0x08, 0x00, 0x40, 0x08, 0x00, 0x40, 0x08, 0x00, 0x40, 0x08, 0x00, 0x40, 
-   0x08, 0x00, 0x60, 0x18, 0x00, 0x30, 0x30, 0x00, 0x0f, 0xc0, 0x00, 0x7f, 0xf8, 0x00, 0x42, 0x08, 
-   0x00, 0x42, 0x08, 0x00, 0x42, 0x08, 0x00, 0x42, 0x08, 0x00, 0x42, 0x08, 0x00, 0x42, 0x08, 0x00, 
-   0x40, 0x08, 0x00, 0x7f, 0xf8, 0x00, 0x02, 0x08, 0x00, 0x02, 0x08, 0x00, 0x02, 0x08, 0x00, 0x02, 
-   0x08, 0x00, 0x02, 0x08, 0x00, 0x02, 0x08, 0x00, 0x0f, 0xc0, 0x00, 0x10, 0x60, 0x00, 0x20, 0x10, 
-   0x00, 0x40, 0x08, 0x00, 0x40, 0x08, 0x00, 0x40, 0x08, 0x00, 0x42, 0x08, 0x00, 0x22, 0x08, 0x00, 
-   0x32, 0x10, 0x00, 0x7e, 0x20, 0x00, 0x7f, 0xf8, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 
-   0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x7f, 0xf8, 
-   0x00, 0x7f, 0xf8, 0x00, 0x38, 0x00, 0x00, 0x60, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 
-   0x60, 0x00, 0x00, 0x3f, 0xf8, 0x00, 0x7f, 0xf8, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 
-   0xc0, 0x00, 0x06, 0x60, 0x00, 0x1c, 0x30, 0x00, 0x30, 0x18, 0x00, 0x60, 0x08, 0x00, 0x7f, 0xf8, 
-   0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 
-   0x40, 0x00, 0x00, 0x7f, 0xf8, 0x00, 0x00, 0x38, 0x00, 0x01, 0xe0, 0x00, 0x0f, 0x00, 0x00, 0x78, 
-   0x00, 0x00, 0x60, 0x00, 0x00, 0x78, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x01, 0xe0, 0x00, 0x00, 0x38, 
-   0x00, 0x7f, 0xf8, 0x00, 0x7f, 0xf8, 0x00, 0x00, 0x38, 0x00, 0x00, 0x60, 0x00, 0x01, 0xc0, 0x00, 
-   0x03, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x18, 0x00, 0x00, 0x70, 0x00, 0x00, 0x7f, 0xf8, 0x00, 0x0f, 
-   0xc0, 0x00, 0x30, 0x30, 0x00, 0x20, 0x10, 0x00, 0x40, 0x08, 0x00, 0x40, 0x08, 0x00, 0x40, 0x08, 
-   0x00, 0x40, 0x08, 0x00, 0x20, 0x10, 0x00, 0x10, 0x20, 0x00, 0x0f, 0xc0, 0x00, 0x7f, 0xf8, 0x00, 
-   0x02, 0x08, 0x00, 0x02, 0x08, 0x00, 0x02, 0x08, 0x00, 0x02, 0x08, 0x00, 0x02, 0x08, 0x00, 0x03, 
-   0x18, 0x00, 0x01, 0xf0, 0x00, 0x0f, 0xc0, 0x00, 0x30, 0x30, 0x00, 0x20, 0x10, 0x00, 0x40, 0x08, 
-   0x00, 0x40, 0x08, 0x00, 0x40, 0x08, 0x00, 0x50, 0x08, 0x00, 0x60, 0x10, 0x00, 0x70, 0x20, 0x00, 
-   0x8f, 0xc0, 0x00, 0x7f, 0xf8, 0x00, 0x01, 0x08, 0x00, 0x01, 0x08, 0x00, 0x01, 0x08, 0x00, 0x01, 
-   0x08, 0x00, 0x01, 0x08, 0x00, 0x01, 0x08, 0x00, 0x03, 0x98, 0x00, 0x7e, 0xf0, 0x00, 0x40, 0x00, 
-   0x00, 0x18, 0xf0, 0x00, 0x21, 0x90, 0x00, 0x41, 0x08, 0x00, 0x43, 0x08, 0x00, 0x43, 0x08, 0x00, 
-   0x42, 0x08, 0x00, 0x26, 0x10, 0x00, 0x1c, 0x30, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 
-   0x08, 0x00, 0x00, 0x08, 0x00, 0x7f, 0xf8, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 
-   0x00, 0x00, 0x08, 0x00, 0x1f, 0xf8, 0x00, 0x20, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 
-   0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x20, 0x00, 0x00, 0x1f, 0xf8, 0x00, 0x00, 
-   0x08, 0x00, 0x00, 0x78, 0x00, 0x01, 0xe0, 0x00, 0x0f, 0x00, 0x00, 0x78, 0x00, 0x00, 0x70, 0x00, 
-   0x00, 0x3e, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x18, 0x00, 0x00, 0x08, 0x00, 
-   0x00, 0xf8, 0x00, 0x0f, 0xc0, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 
-   0xf0, 0x00, 0x00, 0x38, 0x00, 0x01, 0xf0, 0x00, 0x1f, 0x00, 0x00, 0x78, 0x00, 0x00, 0x7c, 0x00, 
-   0x00, 0x0f, 0xc0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x08, 0x00, 0x60, 0x18, 0x00, 0x30, 0x38, 0x00, 
-   0x1c, 0xe0, 0x00, 0x07, 0xc0, 0x00, 0x03, 0x80, 0x00, 0x0e, 0xc0, 0x00, 0x38, 0x70, 0x00, 0x70, 
-   0x18, 0x00, 0x40, 0x08, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0xe0, 0x00, 0x01, 0x80, 
-   0x00, 0x7e, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x08, 0x00, 
-   0x40, 0x00, 0x00, 0x60, 0x08, 0x00, 0x78, 0x08, 0x00, 0x4c, 0x08, 0x00, 0x47, 0x08, 0x00, 0x43, 
-   0x88, 0x00, 0x40, 0xe8, 0x00, 0x40, 0x78, 0x00, 0x40, 0x18, 0x03, 0xff, 0xf8, 0x02, 0x00, 0x08, 
-   0x02, 0x00, 0x08, 0x00, 0x01, 0xe0, 0x00, 0x1e, 0x00, 0x00, 0x60, 0x00, 0x02, 0x00, 0x08, 0x02, 
-   0x00, 0x08, 0x03, 0xff, 0xf8, 0x00, 0x03, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x30, 0x00, 0x00, 
-   0x70, 0x00, 0x03, 0x80, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 
-   0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 
-   0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x10, 0x00, 0x38, 0x80, 0x00, 0x48, 0x40, 0x00, 0x4c, 
-   0x40, 0x00, 0x44, 0x40, 0x00, 0x44, 0x40, 0x00, 0x24, 0x40, 0x00, 0x7f, 0x80, 0x00, 0x40, 0x00, 
-   0x00, 0x7f, 0xf8, 0x00, 0x20, 0x80, 0x00, 0x40, 0x40, 0x00, 0x40, 0x40, 0x00, 0x40, 0x40, 0x00, 
-   0x20, 0x80, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x20, 0x80, 0x00, 0x40, 0x40, 0x00, 0x40, 
-   0x40, 0x00, 0x40, 0x40, 0x00, 0x60, 0xc0, 0x00, 0x31, 0x80, 0x00, 0x1f, 0x00, 0x00, 0x20, 0x80, 
-   0x00, 0x40, 0x40, 0x00, 0x40, 0x40, 0x00, 0x40, 0x40, 0x00, 0x40, 0x40, 0x00, 0x20, 0x80, 0x00, 
-   0x7f, 0xf8, 0x00, 0x1f, 0x00, 0x00, 0x24, 0x80, 0x00, 0x44, 0x40, 0x00, 0x44, 0x40, 0x00, 0x44, 
-   0x40, 0x00, 0x44, 0x40, 0x00, 0x64, 0x80, 0x00, 0x27, 0x00, 0x00, 0x00, 0x40, 0x00, 0x7f, 0xf8, 
-   0x00, 0x00, 0x48, 0x01, 0x1f, 0x00, 0x02, 0x20, 0x80, 0x02, 0x40, 0x40, 0x02, 0x40, 0x40, 0x02, 
-   0x40, 0x40, 0x03, 0x20, 0x80, 0x00, 0xff, 0xc0, 0x00, 0x7f, 0xf8, 0x00, 0x00, 0x80, 0x00, 0x00, 
-   0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x7f, 0x80, 0x00, 0x7f, 0xc8, 0x02, 0x00, 0x00, 
-   0x03, 0xff, 0xc8, 0x00, 0x7f, 0xf8, 0x00, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0f, 0x80, 0x00, 
-   0x38, 0xc0, 0x00, 0x60, 0x40, 0x00, 0x7f, 0xf8, 0x00, 0x7f, 0xc0, 0x00, 0x00, 0x80, 0x00, 0x00, 
-   0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x7f, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x40, 
-   0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x7f, 0x80, 0x00, 0x7f, 0xc0, 0x00, 0x00, 0x80, 0x00, 
-   0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x7f, 0x80, 0x00, 0x1f, 0x00, 0x00, 0x20, 
-   0x80, 0x00, 0x40, 0x40, 0x00, 0x40, 0x40, 0x00, 0x40, 0x40, 0x00, 0x40, 0x40, 0x00, 0x20, 0x80, 
-   0x00, 0x1f, 0x00, 0x03, 0xff, 0xc0, 0x00, 0x20, 0x80, 0x00, 0x40, 0x40, 0x00, 0x40, 0x40, 0x00, 
-   0x40, 0x40, 0x00, 0x20, 0x80, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x20, 0x80, 0x00, 0x40, 
-   0x40, 0x00, 0x40, 0x40, 0x00, 0x40, 0x40, 0x00, 0x40, 0x40, 0x00, 0x20, 0x80, 0x03, 0xff, 0xc0, 
-   0x00, 0x7f, 0xc0, 0x00, 0x00, 0x80, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x23, 0x80, 0x00, 
-   0x44, 0xc0, 0x00, 0x44, 0x40, 0x00, 0x48, 0x40, 0x00, 0x48, 0x40, 0x00, 0x38, 0x80, 0x00, 0x00, 
-   0x40, 0x00, 0x7f, 0xf0, 0x00, 0x40, 0x40, 0x00, 0x3f, 0xc0, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 
-   0x00, 0x40, 0x00, 0x00, 0x20, 0x00, 0x00, 0x7f, 0xc0, 0x00, 0x00, 0x40, 0x00, 0x03, 0xc0, 0x00, 
-   0x1e, 0x00, 0x00, 0x70, 0x00, 0x00, 0x78, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 
-   0x40, 0x00, 0x00, 0xc0, 0x00, 0x0f, 0xc0, 0x00, 0x7c, 0x00, 0x00, 0x70, 0x00, 0x00, 0x1f, 0x00, 
-   0x00, 0x01, 0xc0, 0x00, 0x07, 0xc0, 0x00, 0x7c, 0x00, 0x00, 0x70, 0x00, 0x00, 0x1f, 0x00, 0x00, 
-   0x01, 0xc0, 0x00, 0x40, 0x00, 0x00, 0x60, 0xc0, 0x00, 0x39, 0x80, 0x00, 0x0e, 0x00, 0x00, 0x1f, 
-   0x00, 0x00, 0x31, 0x80, 0x00, 0x60, 0x40, 0x00, 0x00, 0x40, 0x02, 0x03, 0xc0, 0x02, 0x1e, 0x00, 
-   0x01, 0xf0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x40, 0x00, 0x00, 
-   0x60, 0x40, 0x00, 0x58, 0x40, 0x00, 0x4c, 0x40, 0x00, 0x47, 0x40, 0x00, 0x41, 0xc0, 0x00, 0x40, 
-   0xc0, 0x00, 0x04, 0x00, 0x03, 0xfb, 0xf8, 0x02, 0x00, 0x08, 0x07, 0xff, 0xf0, 0x02, 0x00, 0x08, 
-   0x03, 0xfb, 0xf8, 0x00, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 
-   0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x06, 0x00 };
+   0x00, 0x01, 0x02, 0xf8, 0x5f, 0x00, 0x03, 0x02, 0xf0, 0x00, 0xf0, 0x45, 0x09, 0x10, 0x00, 0x80, 
+   0x80, 0xf0, 0x80, 0x80, 0xf0, 0x90, 0x80, 0x08, 0x48, 0x7f, 0x09, 0x08, 0x7c, 0x0f, 0x08, 0x49, 
+   0x07, 0x0d, 0xe0, 0x30, 0x10, 0xf8, 0x10, 0x30, 0x60, 0x31, 0x61, 0x42, 0xff, 0x42, 0x64, 0x3c, 
+   0x46, 0x0e, 0x05, 0xc0, 0x60, 0x20, 0x20, 0x60, 0xc0, 0x41, 0x01, 0x80, 0x60, 0x43, 0x0d, 0x03, 
+   0x06, 0x04, 0x04, 0xc6, 0x33, 0x1c, 0x07, 0x71, 0xd8, 0x88, 0x88, 0xd8, 0x70, 0x4d, 0x09, 0x05, 
+   0x00, 0xe0, 0x90, 0x10, 0x90, 0xe0, 0x42, 0x08, 0x3c, 0x66, 0x43, 0x47, 0x6d, 0x38, 0x38, 0x6c, 
+   0x40, 0x48, 0x01, 0x00, 0xf0, 0x41, 0x03, 0x04, 0x00, 0xe0, 0x10, 0x7f, 0x80, 0x41, 0x01, 0x03, 
+   0x04, 0x03, 0x01, 0x10, 0xe0, 0x41, 0x04, 0x80, 0x7f, 0x04, 0x03, 0x00, 0x05, 0x04, 0x10, 0xe0, 
+   0x38, 0xe0, 0x10, 0x49, 0x07, 0x46, 0xc2, 0x08, 0x00, 0x7f, 0xc2, 0x08, 0x46, 0x01, 0x02, 0x00, 
+   0xc0, 0x01, 0x04, 0x43, 0xc3, 0x04, 0x43, 0x01, 0x02, 0x00, 0x40, 0x00, 0x03, 0x04, 0x00, 0xe0, 
+   0x18, 0x1e, 0x01, 0x43, 0x07, 0x01, 0xc0, 0x20, 0xc2, 0x10, 0x03, 0x20, 0xc0, 0x1f, 0x20, 0xc2, 
+   0x40, 0x01, 0x20, 0x1f, 0x46, 0x03, 0x02, 0x40, 0x60, 0xf0, 0x41, 0x00, 0x7f, 0x42, 0x07, 0x01, 
+   0x60, 0x30, 0xc2, 0x10, 0x08, 0x30, 0xe0, 0x60, 0x58, 0x4c, 0x44, 0x46, 0x42, 0x41, 0x46, 0x07, 
+   0x01, 0x60, 0x30, 0xc2, 0x10, 0x08, 0x30, 0xe0, 0x30, 0x60, 0x40, 0x42, 0x42, 0x67, 0x3d, 0x46, 
+   0x08, 0x42, 0x02, 0xc0, 0x60, 0xf0, 0x41, 0x07, 0x0c, 0x0e, 0x0b, 0x08, 0x08, 0x7f, 0x08, 0x08, 
+   0x47, 0x07, 0x01, 0x80, 0x70, 0xc4, 0x10, 0x01, 0x33, 0x63, 0xc2, 0x41, 0x01, 0x23, 0x1e, 0x46, 
+   0x07, 0x01, 0xc0, 0x20, 0xc2, 0x10, 0x03, 0x20, 0x40, 0x1f, 0x22, 0xc2, 0x41, 0x01, 0x23, 0x1e, 
+   0x46, 0x07, 0xc3, 0x10, 0x06, 0x90, 0x70, 0x10, 0x00, 0x60, 0x1c, 0x03, 0x49, 0x07, 0x01, 0xe0, 
+   0x30, 0xc2, 0x10, 0x03, 0x30, 0xe0, 0x3d, 0x67, 0xc2, 0x42, 0x01, 0x67, 0x3d, 0x46, 0x07, 0x01, 
+   0xc0, 0x20, 0xc2, 0x10, 0x03, 0x20, 0xc0, 0x23, 0x66, 0xc2, 0x44, 0x01, 0x22, 0x1f, 0x46, 0x01, 
+   0x02, 0x40, 0x40, 0x00, 0x01, 0x02, 0x80, 0xc0, 0x01, 0x08, 0x46, 0x08, 0x80, 0x0c, 0x0c, 0x16, 
+   0x12, 0x32, 0x21, 0x61, 0x41, 0x47, 0x08, 0x47, 0xc7, 0x12, 0x47, 0x08, 0x47, 0x07, 0x61, 0x21, 
+   0x23, 0x12, 0x12, 0x1c, 0x0c, 0x08, 0x47, 0x07, 0x01, 0x30, 0x18, 0xc2, 0x08, 0x01, 0x98, 0xf0, 
+   0x42, 0x02, 0x4e, 0x03, 0x01, 0x47, 0x0e, 0x04, 0x00, 0xc0, 0x20, 0x10, 0x10, 0xc2, 0x88, 0x13, 
+   0x08, 0x98, 0x90, 0x30, 0x60, 0x80, 0x1f, 0x60, 0xc0, 0x9e, 0x31, 0x20, 0x20, 0x10, 0x3f, 0x27, 
+   0x21, 0x30, 0x18, 0x0f, 0x43, 0xc5, 0x01, 0x43, 0x0a, 0x42, 0x04, 0xc0, 0x78, 0x18, 0xf0, 0xc0, 
+   0x41, 0x03, 0x40, 0x78, 0x1f, 0x07, 0xc2, 0x04, 0x02, 0x07, 0x3e, 0x70, 0x49, 0x09, 0x00, 0xf8, 
+   0xc4, 0x08, 0x03, 0x18, 0xf0, 0x00, 0x7f, 0xc4, 0x42, 0x02, 0x43, 0x65, 0x3c, 0x48, 0x09, 0x02, 
+   0xc0, 0x30, 0x10, 0xc3, 0x08, 0x04, 0x10, 0x20, 0x0f, 0x30, 0x20, 0xc3, 0x40, 0x01, 0x20, 0x18, 
+   0x48, 0x09, 0x00, 0xf8, 0xc4, 0x08, 0x03, 0x18, 0x30, 0xc0, 0x7f, 0xc4, 0x40, 0x02, 0x60, 0x30, 
+   0x0f, 0x48, 0x08, 0x00, 0xf8, 0xc6, 0x08, 0x00, 0x7f, 0xc5, 0x42, 0x00, 0x40, 0x47, 0x07, 0x00, 
+   0xf8, 0xc5, 0x08, 0x00, 0x7f, 0xc5, 0x02, 0x46, 0x0a, 0x02, 0xc0, 0x60, 0x10, 0xc4, 0x08, 0x04, 
+   0x10, 0x20, 0x0f, 0x10, 0x20, 0xc2, 0x40, 0x03, 0x42, 0x22, 0x32, 0x7e, 0x49, 0x09, 0x00, 0xf8, 
+   0x46, 0x01, 0xf8, 0x7f, 0xc6, 0x02, 0x00, 0x7f, 0x48, 0x01, 0x02, 0xf8, 0x7f, 0x00, 0x06, 0x44, 
+   0x06, 0xf8, 0x38, 0x60, 0x40, 0x40, 0x60, 0x3f, 0x45, 0x08, 0x00, 0xf8, 0x41, 0x0c, 0xc0, 0x60, 
+   0x30, 0x18, 0x08, 0x7f, 0x02, 0x01, 0x03, 0x06, 0x1c, 0x30, 0x60, 0x47, 0x07, 0x00, 0xf8, 0x45, 
+   0x00, 0x7f, 0xc5, 0x40, 0x46, 0x0b, 0x02, 0xf8, 0x38, 0xe0, 0x44, 0x0d, 0xe0, 0x38, 0xf8, 0x7f, 
+   0x00, 0x01, 0x0f, 0x78, 0x60, 0x78, 0x0f, 0x01, 0x00, 0x7f, 0x4a, 0x09, 0x03, 0xf8, 0x38, 0x60, 
+   0xc0, 0x43, 0x01, 0xf8, 0x7f, 0x41, 0x05, 0x01, 0x03, 0x0e, 0x18, 0x70, 0x7f, 0x48, 0x0a, 0x02, 
+   0xc0, 0x30, 0x10, 0xc3, 0x08, 0x05, 0x10, 0x20, 0xc0, 0x0f, 0x30, 0x20, 0xc3, 0x40, 0x02, 0x20, 
+   0x10, 0x0f, 0x49, 0x08, 0x00, 0xf8, 0xc4, 0x08, 0x02, 0x18, 0xf0, 0x7f, 0xc4, 0x02, 0x01, 0x03, 
+   0x01, 0x47, 0x0a, 0x02, 0xc0, 0x30, 0x10, 0xc3, 0x08, 0x05, 0x10, 0x20, 0xc0, 0x0f, 0x30, 0x20, 
+   0xc2, 0x40, 0x03, 0x50, 0x60, 0x70, 0x8f, 0x49, 0x0a, 0x00, 0xf8, 0xc5, 0x08, 0x03, 0x98, 0xf0, 
+   0x00, 0x7f, 0xc5, 0x01, 0x02, 0x03, 0x7e, 0x40, 0x49, 0x08, 0x01, 0xf0, 0x90, 0xc3, 0x08, 0x09, 
+   0x10, 0x30, 0x18, 0x21, 0x41, 0x43, 0x43, 0x42, 0x26, 0x1c, 0x47, 0x09, 0xc3, 0x08, 0x00, 0xf8, 
+   0xc3, 0x08, 0x43, 0x00, 0x7f, 0x4c, 0x09, 0x00, 0xf8, 0x46, 0x02, 0xf8, 0x1f, 0x20, 0xc4, 0x40, 
+   0x01, 0x20, 0x1f, 0x48, 0x0a, 0x02, 0x08, 0x78, 0xe0, 0x43, 0x02, 0xc0, 0xf8, 0x18, 0x41, 0x05, 
+   0x01, 0x0f, 0x78, 0x70, 0x3e, 0x07, 0x4b, 0x0f, 0x02, 0x08, 0xf8, 0xc0, 0x41, 0x03, 0x80, 0xf0, 
+   0x38, 0xf0, 0x42, 0x02, 0xc0, 0xf8, 0x08, 0x41, 0x03, 0x0f, 0x78, 0x78, 0x07, 0x41, 0x04, 0x01, 
+   0x1f, 0x78, 0x7c, 0x0f, 0x50, 0x09, 0x11, 0x18, 0x38, 0xe0, 0xc0, 0x80, 0xc0, 0x70, 0x18, 0x08, 
+   0x60, 0x30, 0x1c, 0x07, 0x03, 0x0e, 0x38, 0x70, 0x40, 0x48, 0x09, 0x08, 0x18, 0x38, 0xe0, 0x80, 
+   0x00, 0x80, 0xe0, 0x38, 0x08, 0x42, 0x02, 0x01, 0x7e, 0x01, 0x4b, 0x09, 0x00, 0x00, 0xc3, 0x08, 
+   0x09, 0x88, 0xe8, 0x78, 0x18, 0x40, 0x60, 0x78, 0x4c, 0x47, 0x43, 0xc2, 0x40, 0x48, 0x03, 0x03, 
+   0xf8, 0x08, 0x08, 0xff, 0x41, 0x02, 0x03, 0x02, 0x02, 0x03, 0x00, 0xe0, 0x41, 0x02, 0x01, 0x1e, 
+   0x60, 0x42, 0x03, 0x02, 0x08, 0x08, 0xf8, 0x41, 0x03, 0xff, 0x02, 0x02, 0x03, 0x06, 0x06, 0x00, 
+   0xc0, 0x30, 0x70, 0x80, 0x00, 0x03, 0x42, 0x01, 0x03, 0x02, 0x45, 0x09, 0x51, 0xc8, 0x02, 0x02, 
+   0x01, 0x08, 0x10, 0x43, 0x08, 0x00, 0x80, 0xc4, 0x40, 0x09, 0x80, 0x00, 0x38, 0x48, 0x4c, 0x44, 
+   0x44, 0x24, 0x7f, 0x40, 0x47, 0x07, 0x01, 0xf8, 0x80, 0xc2, 0x40, 0x03, 0x80, 0x00, 0x7f, 0x20, 
+   0xc2, 0x40, 0x01, 0x20, 0x1f, 0x46, 0x07, 0x01, 0x00, 0x80, 0xc2, 0x40, 0x03, 0xc0, 0x80, 0x1f, 
+   0x20, 0xc2, 0x40, 0x01, 0x60, 0x31, 0x46, 0x08, 0x01, 0x00, 0x80, 0xc3, 0x40, 0x03, 0x80, 0xf8, 
+   0x1f, 0x20, 0xc3, 0x40, 0x01, 0x20, 0x7f, 0x47, 0x08, 0x01, 0x00, 0x80, 0xc3, 0x40, 0x03, 0x80, 
+   0x00, 0x1f, 0x24, 0xc3, 0x44, 0x01, 0x64, 0x27, 0x47, 0x03, 0x04, 0x40, 0xf8, 0x48, 0x00, 0x7f, 
+   0x43, 0x07, 0x01, 0x00, 0x80, 0xc2, 0x40, 0x03, 0x80, 0xc0, 0x1f, 0x20, 0xc2, 0x40, 0x02, 0x20, 
+   0xff, 0x01, 0xc3, 0x02, 0x01, 0x03, 0x00, 0x06, 0x01, 0xf8, 0x80, 0xc2, 0x40, 0x01, 0x80, 0x7f, 
+   0x43, 0x00, 0x7f, 0x45, 0x01, 0x02, 0xc8, 0x7f, 0x00, 0x02, 0x05, 0x00, 0xc8, 0x00, 0xff, 0x02, 
+   0x03, 0x06, 0x00, 0xf8, 0x41, 0x08, 0x80, 0xc0, 0x40, 0x7f, 0x06, 0x03, 0x0f, 0x38, 0x60, 0x45, 
+   0x01, 0x02, 0xf8, 0x7f, 0x00, 0x0b, 0x01, 0xc0, 0x80, 0xc2, 0x40, 0x01, 0x80, 0x80, 0xc2, 0x40, 
+   0x01, 0x80, 0x7f, 0x43, 0x00, 0x7f, 0x43, 0x00, 0x7f, 0x4a, 0x06, 0x01, 0xc0, 0x80, 0xc2, 0x40, 
+   0x01, 0x80, 0x7f, 0x43, 0x00, 0x7f, 0x45, 0x08, 0x01, 0x00, 0x80, 0xc3, 0x40, 0x03, 0x80, 0x00, 
+   0x1f, 0x20, 0xc3, 0x40, 0x01, 0x20, 0x1f, 0x47, 0x07, 0x01, 0xc0, 0x80, 0xc2, 0x40, 0x03, 0x80, 
+   0x00, 0xff, 0x20, 0xc2, 0x40, 0x02, 0x20, 0x1f, 0x03, 0x45, 0x08, 0x01, 0x00, 0x80, 0xc3, 0x40, 
+   0x03, 0x80, 0xc0, 0x1f, 0x20, 0xc3, 0x40, 0x01, 0x20, 0xff, 0x46, 0x00, 0x03, 0x04, 0x04, 0xc0, 
+   0x80, 0x40, 0x40, 0x7f, 0x46, 0x06, 0x01, 0x80, 0xc0, 0xc2, 0x40, 0x06, 0x80, 0x23, 0x44, 0x44, 
+   0x48, 0x48, 0x38, 0x45, 0x03, 0x05, 0x40, 0xf0, 0x40, 0x00, 0x7f, 0x40, 0x42, 0x06, 0x00, 0xc0, 
+   0x43, 0x01, 0xc0, 0x3f, 0xc2, 0x40, 0x01, 0x20, 0x7f, 0x45, 0x08, 0x01, 0x40, 0xc0, 0x43, 0x08, 
+   0xc0, 0x40, 0x00, 0x03, 0x1e, 0x70, 0x78, 0x0f, 0x03, 0x48, 0x0b, 0x01, 0xc0, 0xc0, 0x42, 0x01, 
+   0xc0, 0xc0, 0x42, 0x0b, 0xc0, 0x00, 0x0f, 0x7c, 0x70, 0x1f, 0x01, 0x07, 0x7c, 0x70, 0x1f, 0x01, 
+   0x4a, 0x07, 0x02, 0x00, 0xc0, 0x80, 0x41, 0x08, 0x80, 0x40, 0x40, 0x60, 0x39, 0x0e, 0x1f, 0x31, 
+   0x60, 0x46, 0x07, 0x01, 0x40, 0xc0, 0x43, 0x0b, 0xc0, 0x00, 0x03, 0x1e, 0xf0, 0x78, 0x0f, 0x01, 
+   0x00, 0x02, 0x02, 0x01, 0x42, 0x07, 0x00, 0x00, 0xc3, 0x40, 0x08, 0xc0, 0xc0, 0x40, 0x60, 0x58, 
+   0x4c, 0x47, 0x41, 0x40, 0x46, 0x03, 0x04, 0x00, 0xf8, 0x08, 0x04, 0xfb, 0x41, 0x01, 0x03, 0x02, 
+   0x01, 0x02, 0xf0, 0xff, 0x07, 0x03, 0x01, 0x08, 0xf8, 0x41, 0x04, 0xfb, 0x04, 0x02, 0x03, 0x00, 
+   0x07, 0x46, 0x06, 0x02, 0x01, 0x01, 0x02, 0x04, 0x04, 0x06, 0x46 };
 
 static const FontChar freesans16_chars[] = {
-   {    0,  0,  4,  4 },      // ' '
-   {    0,  3,  2,  5 },      // '!'
-   {    3,  9,  1,  5 },      // '"'
-   {   12, 27,  0,  9 },      // '#'
-   {   39, 21,  1,  9 },      // '$'
-   {   60, 42,  0, 14 },      // '%'
-   {  102, 27,  1, 11 },      // '&'
-   {  129,  3,  1,  3 },      // '''
-   {  132,  9,  1,  5 },      // '('
-   {  141,  9,  1,  5 },      // ')'
-   {  150, 15,  1,  6 },      // '*'
-   {  165, 21,  1,  9 },      // '+'
-   {  186,  3,  1,  4 },      // ','
-   {  189, 12,  1,  5 },      // '-'
-   {  201,  3,  1,  4 },      // '.'
-   {  204,  9,  0,  6 },      // '/'
-   {  213, 21,  1,  9 },      // '0'
-   {  234,  9,  2,  9 },      // '1'
-   {  243, 21,  1,  9 },      // '2'
-   {  264, 21,  1,  9 },      // '3'
-   {  285, 24,  0,  9 },      // '4'
-   {  309, 21,  1,  9 },      // '5'
-   {  330, 21,  1,  9 },      // '6'
-   {  351, 21,  1,  9 },      // '7'
-   {  372, 21,  1,  9 },      // '8'
-   {  393, 21,  1,  9 },      // '9'
-   {  414,  3,  1,  4 },      // ':'
-   {  417,  3,  1,  4 },      // ';'
-   {  420, 24,  1,  9 },      // '<'
-   {  444, 24,  1,  9 },      // '='
-   {  468, 24,  1,  9 },      // '>'
-   {  492, 21,  1,  9 },      // '?'
-   {  513, 42,  1, 16 },      // '@'
-   {  555, 30,  0, 11 },      // 'A'
-   {  585, 27,  1, 11 },      // 'B'
-   {  612, 27,  1, 11 },      // 'C'
-   {  639, 27,  1, 11 },      // 'D'
-   {  666, 24,  1, 10 },      // 'E'
-   {  690, 21,  1, 10 },      // 'F'
-   {  711, 30,  1, 12 },      // 'G'
-   {  741, 27,  1, 12 },      // 'H'
-   {  768,  3,  2,  4 },      // 'I'
-   {  771, 18,  1,  8 },      // 'J'
-   {  789, 24,  1, 11 },      // 'K'
-   {  813, 21,  1,  9 },      // 'L'
-   {  834, 33,  1, 14 },      // 'M'
-   {  867, 27,  1, 12 },      // 'N'
-   {  894, 30,  1, 13 },      // 'O'
-   {  924, 24,  1, 11 },      // 'P'
-   {  948, 30,  1, 13 },      // 'Q'
-   {  978, 30,  1, 11 },      // 'R'
-   { 1008, 24,  1, 11 },      // 'S'
-   { 1032, 27,  0, 10 },      // 'T'
-   { 1059, 27,  1, 12 },      // 'U'
-   { 1086, 30,  0, 11 },      // 'V'
-   { 1116, 45,  0, 15 },      // 'W'
-   { 1161, 27,  1, 11 },      // 'X'
-   { 1188, 27,  1, 11 },      // 'Y'
-   { 1215, 27,  0, 10 },      // 'Z'
-   { 1242,  9,  1,  4 },      // '['
-   { 1251,  9,  0,  6 },      // '\'
-   { 1260,  9,  0,  4 },      // ']'
-   { 1269, 18,  1,  8 },      // '^'
-   { 1287, 27,  0, 11 },      // '_'
-   { 1314,  6,  1,  4 },      // '`'
-   { 1320, 24,  0,  9 },      // 'a'
-   { 1344, 21,  1,  9 },      // 'b'
-   { 1365, 21,  0,  8 },      // 'c'
-   { 1386, 24,  0,  9 },      // 'd'
-   { 1410, 24,  0,  9 },      // 'e'
-   { 1434,  9,  0,  5 },      // 'f'
-   { 1443, 21,  0,  9 },      // 'g'
-   { 1464, 18,  1,  9 },      // 'h'
-   { 1482,  3,  1,  4 },      // 'i'
-   { 1485,  6,  1,  4 },      // 'j'
-   { 1491, 18,  1,  9 },      // 'k'
-   { 1509,  3,  1,  3 },      // 'l'
-   { 1512, 33,  1, 13 },      // 'm'
-   { 1545, 18,  1,  9 },      // 'n'
-   { 1563, 24,  0,  9 },      // 'o'
-   { 1587, 21,  1,  9 },      // 'p'
-   { 1608, 24,  0,  9 },      // 'q'
-   { 1632, 12,  1,  5 },      // 'r'
-   { 1644, 18,  1,  8 },      // 's'
-   { 1662,  9,  0,  5 },      // 't'
-   { 1671, 18,  1,  9 },      // 'u'
-   { 1689, 24,  0,  8 },      // 'v'
-   { 1713, 33,  0, 12 },      // 'w'
-   { 1746, 21,  0,  8 },      // 'x'
-   { 1767, 21,  0,  8 },      // 'y'
-   { 1788, 21,  0,  8 },      // 'z'
-   { 1809,  9,  1,  5 },      // '{'
-   { 1818,  3,  2,  4 },      // '|'
-   { 1821,  9,  1,  5 },      // '}'
-   { 1830, 21,  1,  8 },      // '~'
+   {    0,  1,  4,  4 },      // ' '
+   {    1,  5,  2,  5 },      // '!'
+   {    6,  6,  1,  5 },      // '"'
+   {   12, 20,  0,  9 },      // '#'
+   {   32, 17,  1,  9 },      // '$'
+   {   49, 29,  0, 14 },      // '%'
+   {   78, 20,  1, 11 },      // '&'
+   {   98,  4,  1,  3 },      // '''
+   {  102, 11,  1,  5 },      // '('
+   {  113, 11,  1,  5 },      // ')'
+   {  124,  8,  1,  6 },      // '*'
+   {  132,  9,  1,  9 },      // '+'
+   {  141,  5,  1,  4 },      // ','
+   {  146,  5,  1,  5 },      // '-'
+   {  151,  5,  1,  4 },      // '.'
+   {  156,  8,  0,  6 },      // '/'
+   {  164, 17,  1,  9 },      // '0'
+   {  181,  9,  2,  9 },      // '1'
+   {  190, 17,  1,  9 },      // '2'
+   {  207, 17,  1,  9 },      // '3'
+   {  224, 17,  0,  9 },      // '4'
+   {  241, 15,  1,  9 },      // '5'
+   {  256, 17,  1,  9 },      // '6'
+   {  273, 12,  1,  9 },      // '7'
+   {  285, 17,  1,  9 },      // '8'
+   {  302, 17,  1,  9 },      // '9'
+   {  319,  5,  1,  4 },      // ':'
+   {  324,  5,  1,  4 },      // ';'
+   {  329, 13,  1,  9 },      // '<'
+   {  342,  5,  1,  9 },      // '='
+   {  347, 12,  1,  9 },      // '>'
+   {  359, 15,  1,  9 },      // '?'
+   {  374, 34,  1, 16 },      // '@'
+   {  408, 21,  0, 11 },      // 'A'
+   {  429, 17,  1, 11 },      // 'B'
+   {  446, 19,  1, 11 },      // 'C'
+   {  465, 17,  1, 11 },      // 'D'
+   {  482, 12,  1, 10 },      // 'E'
+   {  494, 10,  1, 10 },      // 'F'
+   {  504, 21,  1, 12 },      // 'G'
+   {  525, 12,  1, 12 },      // 'H'
+   {  537,  5,  2,  4 },      // 'I'
+   {  542, 11,  1,  8 },      // 'J'
+   {  553, 19,  1, 11 },      // 'K'
+   {  572,  9,  1,  9 },      // 'L'
+   {  581, 22,  1, 14 },      // 'M'
+   {  603, 19,  1, 12 },      // 'N'
+   {  622, 21,  1, 13 },      // 'O'
+   {  643, 15,  1, 11 },      // 'P'
+   {  658, 22,  1, 13 },      // 'Q'
+   {  680, 17,  1, 11 },      // 'R'
+   {  697, 18,  1, 11 },      // 'S'
+   {  715, 11,  0, 10 },      // 'T'
+   {  726, 14,  1, 12 },      // 'U'
+   {  740, 19,  0, 11 },      // 'V'
+   {  759, 30,  0, 15 },      // 'W'
+   {  789, 21,  1, 11 },      // 'X'
+   {  810, 17,  1, 11 },      // 'Y'
+   {  827, 19,  0, 10 },      // 'Z'
+   {  846, 11,  1,  4 },      // '['
+   {  857,  9,  0,  6 },      // '\'
+   {  866, 11,  0,  4 },      // ']'
+   {  877, 14,  1,  8 },      // '^'
+   {  891,  4,  0, 11 },      // '_'
+   {  895,  5,  1,  4 },      // '`'
+   {  900, 17,  0,  9 },      // 'a'
+   {  917, 17,  1,  9 },      // 'b'
+   {  934, 17,  0,  8 },      // 'c'
+   {  951, 17,  0,  9 },      // 'd'
+   {  968, 17,  0,  9 },      // 'e'
+   {  985,  8,  0,  5 },      // 'f'
+   {  993, 22,  0,  9 },      // 'g'
+   { 1015, 13,  1,  9 },      // 'h'
+   { 1028,  5,  1,  4 },      // 'i'
+   { 1033,  8,  1,  4 },      // 'j'
+   { 1041, 15,  1,  9 },      // 'k'
+   { 1056,  5,  1,  3 },      // 'l'
+   { 1061, 21,  1, 13 },      // 'm'
+   { 1082, 13,  1,  9 },      // 'n'
+   { 1095, 17,  0,  9 },      // 'o'
+   { 1112, 18,  1,  9 },      // 'p'
+   { 1130, 19,  0,  9 },      // 'q'
+   { 1149,  8,  1,  5 },      // 'r'
+   { 1157, 15,  1,  8 },      // 's'
+   { 1172,  9,  0,  5 },      // 't'
+   { 1181, 13,  1,  9 },      // 'u'
+   { 1194, 16,  0,  8 },      // 'v'
+   { 1210, 23,  0, 12 },      // 'w'
+   { 1233, 17,  0,  8 },      // 'x'
+   { 1250, 19,  0,  8 },      // 'y'
+   { 1269, 16,  0,  8 },      // 'z'
+   { 1285, 11,  1,  5 },      // '{'
+   { 1296,  5,  2,  4 },      // '|'
+   { 1301, 11,  1,  5 },      // '}'
+   { 1312, 11,  1,  8 },      // '~'
 };
 
-static const FontInfo freesans16 = { freesans16_bitmap, freesans16_chars, 19, 32, 126 };
+static const FontInfo freesans16 = { freesans16_bitmap, freesans16_chars, 19, 32, 126, FONT_FLG_RLE };
@@ -1,255 +1,228 @@
 // Auto-generated font header
 // Input font file: /usr/share/fonts/truetype/freefont/FreeSans.ttf
 // Font point size: 20
+// Compressed
 
 static const uint8_t freesans20_bitmap[] = {
-   0x03, 0x3f, 0xf8, 0x03, 0x3f, 0xf8, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 
-   0x01, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x30, 0x00, 0x00, 0x31, 0x80, 0x03, 0xf1, 0x80, 0x00, 0xff, 
-   0x80, 0x00, 0x33, 0xf0, 0x00, 0x31, 0x90, 0x03, 0xf1, 0x80, 0x00, 0xff, 0x80, 0x00, 0x33, 0xf0, 
-   0x00, 0x31, 0x90, 0x00, 0x01, 0x80, 0x00, 0xc3, 0xe0, 0x01, 0xc7, 0xf0, 0x03, 0x86, 0x38, 0x03, 
-   0x0c, 0x18, 0x07, 0xff, 0xfc, 0x03, 0x0c, 0x18, 0x03, 0x08, 0x18, 0x01, 0x98, 0x30, 0x01, 0xf8, 
-   0xf0, 0x00, 0xf0, 0xe0, 0x00, 0x03, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x0c, 0x60, 0x00, 0x0c, 0x60, 
-   0x04, 0x0c, 0x60, 0x03, 0x07, 0xc0, 0x00, 0xc3, 0x80, 0x00, 0x30, 0x00, 0x00, 0x0c, 0x00, 0x01, 
-   0xc6, 0x00, 0x03, 0xe1, 0x80, 0x07, 0x70, 0x60, 0x06, 0x30, 0x00, 0x06, 0x30, 0x00, 0x07, 0x70, 
-   0x00, 0x03, 0xe0, 0x00, 0x01, 0xc0, 0x00, 0x00, 0xf0, 0x00, 0x01, 0xf8, 0x00, 0x03, 0x99, 0xc0, 
-   0x03, 0x0f, 0xe0, 0x03, 0x06, 0x30, 0x03, 0x0e, 0x30, 0x03, 0x1a, 0x30, 0x01, 0xb3, 0xe0, 0x00, 
-   0xe1, 0xc0, 0x01, 0xf8, 0x00, 0x03, 0x18, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 
-   0xf0, 0x00, 0xfe, 0x00, 0x03, 0xff, 0x80, 0x0e, 0x00, 0xe0, 0x38, 0x00, 0x18, 0x20, 0x00, 0x00, 
-   0x20, 0x00, 0x00, 0x38, 0x00, 0x18, 0x0e, 0x00, 0xe0, 0x03, 0xff, 0x80, 0x00, 0xfe, 0x00, 0x00, 
-   0x00, 0x20, 0x00, 0x01, 0xa0, 0x00, 0x00, 0x78, 0x00, 0x01, 0xa0, 0x00, 0x00, 0x20, 0x00, 0x30, 
-   0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x03, 0xfe, 0x00, 0x03, 0xfe, 0x00, 0x00, 0x30, 0x00, 
-   0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x13, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 
-   0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 
-   0x00, 0x01, 0xe0, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x18, 
-   0x00, 0x7f, 0x80, 0x01, 0xff, 0xe0, 0x03, 0xc0, 0xf0, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 
-   0x00, 0x30, 0x03, 0xc0, 0xf0, 0x01, 0xff, 0xe0, 0x00, 0x7f, 0x80, 0x00, 0x00, 0xc0, 0x00, 0x00, 
-   0xc0, 0x03, 0xff, 0xe0, 0x03, 0xff, 0xf0, 0x03, 0x80, 0xc0, 0x03, 0xc0, 0xe0, 0x03, 0x60, 0x70, 
-   0x03, 0x30, 0x30, 0x03, 0x18, 0x30, 0x03, 0x18, 0x30, 0x03, 0x0c, 0x70, 0x03, 0x07, 0xe0, 0x03, 
-   0x03, 0xc0, 0x00, 0xc0, 0xc0, 0x01, 0xc0, 0xe0, 0x03, 0x80, 0x70, 0x03, 0x00, 0x30, 0x03, 0x06, 
-   0x30, 0x03, 0x06, 0x30, 0x03, 0x8e, 0x70, 0x01, 0xff, 0xe0, 0x00, 0xf9, 0xc0, 0x00, 0x70, 0x00, 
-   0x00, 0x6c, 0x00, 0x00, 0x62, 0x00, 0x00, 0x61, 0x80, 0x00, 0x60, 0xc0, 0x03, 0xff, 0xf0, 0x03, 
-   0xff, 0xf0, 0x00, 0x60, 0x00, 0x00, 0x87, 0x00, 0x01, 0x87, 0xf0, 0x03, 0x06, 0xf0, 0x03, 0x03, 
-   0x30, 0x03, 0x03, 0x30, 0x03, 0x03, 0x30, 0x03, 0x87, 0x30, 0x01, 0xfe, 0x30, 0x00, 0x7c, 0x00, 
-   0x00, 0x7f, 0x00, 0x01, 0xff, 0xc0, 0x03, 0x8c, 0xe0, 0x03, 0x06, 0x30, 0x03, 0x06, 0x30, 0x03, 
-   0x06, 0x30, 0x03, 0x8e, 0x70, 0x01, 0xfc, 0xe0, 0x00, 0xf8, 0x80, 0x00, 0x00, 0x30, 0x00, 0x00, 
-   0x30, 0x03, 0x00, 0x30, 0x03, 0xe0, 0x30, 0x00, 0x78, 0x30, 0x00, 0x0e, 0x30, 0x00, 0x03, 0xb0, 
-   0x00, 0x00, 0xf0, 0x00, 0x00, 0x30, 0x00, 0x70, 0x00, 0x01, 0xf9, 0xc0, 0x01, 0x8f, 0xe0, 0x03, 
-   0x06, 0x30, 0x03, 0x06, 0x30, 0x03, 0x06, 0x30, 0x01, 0x8f, 0xe0, 0x01, 0xf9, 0xc0, 0x00, 0x70, 
-   0x00, 0x00, 0x87, 0xc0, 0x01, 0x8f, 0xe0, 0x03, 0x9c, 0x70, 0x03, 0x18, 0x30, 0x03, 0x18, 0x30, 
-   0x03, 0x18, 0x30, 0x01, 0xcc, 0x70, 0x00, 0xff, 0xe0, 0x00, 0x3f, 0x80, 0x03, 0x01, 0x80, 0x03, 
-   0x01, 0x80, 0x13, 0x03, 0x00, 0x0f, 0x03, 0x00, 0x00, 0x30, 0x00, 0x00, 0x70, 0x00, 0x00, 0x78, 
-   0x00, 0x00, 0x48, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x8c, 0x00, 0x01, 0x84, 0x00, 0x01, 0x86, 0x00, 
-   0x01, 0x02, 0x00, 0x03, 0x03, 0x00, 0x00, 0xcc, 0x00, 0x00, 0xcc, 0x00, 0x00, 0xcc, 0x00, 0x00, 
-   0xcc, 0x00, 0x00, 0xcc, 0x00, 0x00, 0xcc, 0x00, 0x00, 0xcc, 0x00, 0x00, 0xcc, 0x00, 0x00, 0xcc, 
-   0x00, 0x00, 0xcc, 0x00, 0x03, 0x02, 0x00, 0x01, 0x06, 0x00, 0x01, 0x86, 0x00, 0x01, 0x84, 0x00, 
-   0x00, 0x8c, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x58, 0x00, 0x00, 0x70, 0x00, 0x00, 0x30, 0x00, 0x00, 
-   0x30, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x70, 0x00, 0x00, 0x18, 0x03, 0x30, 0x18, 0x03, 0x3c, 
-   0x18, 0x00, 0x06, 0x38, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xe0, 0x00, 0x7c, 0x00, 0x01, 0xff, 0x80, 
-   0x07, 0x83, 0xc0, 0x06, 0x00, 0xe0, 0x0c, 0x7c, 0x70, 0x0c, 0xfe, 0x30, 0x19, 0xc7, 0x38, 0x19, 
-   0x83, 0x98, 0x19, 0x81, 0x98, 0x18, 0xc1, 0x98, 0x18, 0xe1, 0x98, 0x19, 0xfe, 0x18, 0x09, 0x8f, 
-   0x30, 0x01, 0x80, 0x30, 0x01, 0xc0, 0x60, 0x00, 0xe1, 0xe0, 0x00, 0x7f, 0xc0, 0x00, 0x1f, 0x00, 
-   0x02, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x37, 0xc0, 0x00, 
-   0x30, 0xf8, 0x00, 0x30, 0x38, 0x00, 0x30, 0xf8, 0x00, 0x37, 0xe0, 0x00, 0x3f, 0x00, 0x01, 0xf8, 
-   0x00, 0x03, 0xc0, 0x00, 0x03, 0x00, 0x00, 0x03, 0xff, 0xf8, 0x03, 0xff, 0xf8, 0x03, 0x06, 0x18, 
-   0x03, 0x06, 0x18, 0x03, 0x06, 0x18, 0x03, 0x06, 0x18, 0x03, 0x06, 0x18, 0x03, 0x07, 0x38, 0x03, 
-   0x8d, 0xf0, 0x01, 0xf9, 0xe0, 0x00, 0xf0, 0x00, 0x00, 0x3f, 0x80, 0x00, 0xff, 0xe0, 0x01, 0xe0, 
-   0xf0, 0x01, 0x80, 0x30, 0x03, 0x00, 0x18, 0x03, 0x00, 0x18, 0x03, 0x00, 0x18, 0x03, 0x00, 0x18, 
-   0x03, 0x00, 0x18, 0x01, 0xc0, 0x30, 0x01, 0xe0, 0x70, 0x00, 0x60, 0x40, 0x03, 0xff, 0xf8, 0x03, 
-   0xff, 0xf8, 0x03, 0x00, 0x18, 0x03, 0x00, 0x18, 0x03, 0x00, 0x18, 0x03, 0x00, 0x18, 0x03, 0x00, 
-   0x18, 0x03, 0x80, 0x38, 0x01, 0xc0, 0x70, 0x00, 0xff, 0xe0, 0x00, 0x3f, 0x80, 0x03, 0xff, 0xf8, 
-   0x03, 0xff, 0xf8, 0x03, 0x06, 0x18, 0x03, 0x06, 0x18, 0x03, 0x06, 0x18, 0x03, 0x06, 0x18, 0x03, 
-   0x06, 0x18, 0x03, 0x06, 0x18, 0x03, 0x06, 0x18, 0x03, 0x00, 0x18, 0x03, 0xff, 0xf8, 0x03, 0xff, 
-   0xf8, 0x00, 0x06, 0x18, 0x00, 0x06, 0x18, 0x00, 0x06, 0x18, 0x00, 0x06, 0x18, 0x00, 0x06, 0x18, 
-   0x00, 0x06, 0x18, 0x00, 0x00, 0x18, 0x00, 0x3f, 0x00, 0x00, 0xff, 0xc0, 0x01, 0xe0, 0xf0, 0x01, 
-   0x80, 0x30, 0x03, 0x80, 0x38, 0x03, 0x00, 0x18, 0x03, 0x00, 0x18, 0x03, 0x0c, 0x18, 0x03, 0x0c, 
-   0x18, 0x01, 0x8c, 0x18, 0x00, 0xcc, 0x30, 0x01, 0xfc, 0x70, 0x03, 0xfc, 0x40, 0x03, 0xff, 0xf8, 
-   0x03, 0xff, 0xf8, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 
-   0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x03, 0xff, 0xf8, 0x03, 0xff, 0xf8, 0x03, 0xff, 
-   0xf8, 0x03, 0xff, 0xf8, 0x00, 0xe0, 0x00, 0x01, 0xe0, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 
-   0x03, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x03, 0xff, 0xf8, 0x03, 
-   0xff, 0xf8, 0x00, 0x0c, 0x00, 0x00, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x1c, 
-   0xc0, 0x00, 0x70, 0x60, 0x00, 0xe0, 0x30, 0x03, 0x80, 0x18, 0x03, 0x00, 0x08, 0x03, 0xff, 0xf8, 
-   0x03, 0xff, 0xf8, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 
-   0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0xff, 0xf8, 0x03, 0xff, 0xf8, 0x00, 0x00, 
-   0x78, 0x00, 0x03, 0xe0, 0x00, 0x1f, 0x00, 0x00, 0xf8, 0x00, 0x03, 0xc0, 0x00, 0x03, 0x80, 0x00, 
-   0x00, 0xf8, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x03, 0xe0, 0x00, 0x00, 0x78, 0x03, 0xff, 0xf8, 0x03, 
-   0xff, 0xf8, 0x03, 0xff, 0xf8, 0x03, 0xff, 0xf8, 0x00, 0x00, 0x78, 0x00, 0x01, 0xe0, 0x00, 0x03, 
-   0x80, 0x00, 0x0e, 0x00, 0x00, 0x38, 0x00, 0x00, 0xe0, 0x00, 0x03, 0xc0, 0x00, 0x03, 0xff, 0xf8, 
-   0x03, 0xff, 0xf8, 0x00, 0x1f, 0x00, 0x00, 0x7f, 0xc0, 0x00, 0xe0, 0xe0, 0x01, 0x80, 0x30, 0x03, 
-   0x80, 0x38, 0x03, 0x00, 0x18, 0x03, 0x00, 0x18, 0x03, 0x00, 0x18, 0x03, 0x00, 0x18, 0x03, 0x80, 
-   0x38, 0x01, 0x80, 0x30, 0x00, 0xe0, 0xe0, 0x00, 0x7f, 0xc0, 0x00, 0x3f, 0x80, 0x03, 0xff, 0xf8, 
-   0x03, 0xff, 0xf8, 0x00, 0x0c, 0x18, 0x00, 0x0c, 0x18, 0x00, 0x0c, 0x18, 0x00, 0x0c, 0x18, 0x00, 
-   0x0c, 0x18, 0x00, 0x0e, 0x38, 0x00, 0x07, 0xf0, 0x00, 0x03, 0xe0, 0x00, 0x3e, 0x00, 0x00, 0xff, 
-   0x80, 0x01, 0xc1, 0xc0, 0x03, 0x00, 0x60, 0x07, 0x00, 0x70, 0x06, 0x00, 0x30, 0x06, 0x00, 0x30, 
-   0x06, 0x00, 0x30, 0x06, 0x80, 0x30, 0x03, 0x80, 0x70, 0x03, 0x00, 0x60, 0x07, 0xc1, 0xc0, 0x0e, 
-   0xff, 0x80, 0x00, 0x3f, 0x00, 0x03, 0xff, 0xf8, 0x03, 0xff, 0xf8, 0x00, 0x0c, 0x18, 0x00, 0x0c, 
-   0x18, 0x00, 0x0c, 0x18, 0x00, 0x0c, 0x18, 0x00, 0x0c, 0x18, 0x00, 0x0c, 0x18, 0x00, 0x1e, 0x38, 
-   0x03, 0xfb, 0xf0, 0x03, 0xf1, 0xe0, 0x02, 0x00, 0x00, 0x00, 0x61, 0xe0, 0x01, 0xe3, 0xf0, 0x01, 
-   0x87, 0x30, 0x03, 0x86, 0x18, 0x03, 0x06, 0x18, 0x03, 0x04, 0x18, 0x03, 0x0c, 0x18, 0x03, 0x0c, 
-   0x18, 0x03, 0x0c, 0x18, 0x01, 0x98, 0x30, 0x01, 0xf8, 0x70, 0x00, 0x70, 0x60, 0x00, 0x00, 0x18, 
-   0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x03, 0xff, 0xf8, 0x03, 0xff, 0xf8, 0x00, 
-   0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x7f, 0xf8, 0x01, 0xff, 
-   0xf8, 0x01, 0x80, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 
-   0x03, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0xff, 0xf8, 0x00, 0x7f, 0xf8, 0x00, 0x00, 0x08, 0x00, 
-   0x00, 0x38, 0x00, 0x01, 0xf0, 0x00, 0x0f, 0x80, 0x00, 0x7c, 0x00, 0x03, 0xe0, 0x00, 0x03, 0x80, 
-   0x00, 0x03, 0xe0, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x38, 
-   0x00, 0x00, 0x08, 0x00, 0x00, 0xf8, 0x00, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x03, 0xe0, 0x00, 0x03, 
-   0xe0, 0x00, 0x01, 0xfc, 0x00, 0x00, 0x3f, 0xc0, 0x00, 0x03, 0xf8, 0x00, 0x00, 0x78, 0x00, 0x03, 
-   0xf0, 0x00, 0x3f, 0x80, 0x01, 0xf8, 0x00, 0x03, 0x80, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x7f, 0x80, 
-   0x00, 0x07, 0xf8, 0x00, 0x00, 0x78, 0x03, 0x00, 0x08, 0x03, 0x80, 0x38, 0x01, 0xe0, 0x70, 0x00, 
-   0x71, 0xc0, 0x00, 0x1f, 0x80, 0x00, 0x0e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x71, 0xc0, 0x00, 0xe0, 
-   0xf0, 0x03, 0xc0, 0x38, 0x03, 0x00, 0x18, 0x02, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 
-   0x00, 0x00, 0xf0, 0x00, 0x03, 0xc0, 0x00, 0x07, 0x00, 0x03, 0xfe, 0x00, 0x03, 0xfe, 0x00, 0x00, 
-   0x07, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x03, 0x80, 
-   0x18, 0x03, 0xc0, 0x18, 0x03, 0x70, 0x18, 0x03, 0x38, 0x18, 0x03, 0x1c, 0x18, 0x03, 0x0e, 0x18, 
-   0x03, 0x03, 0x98, 0x03, 0x01, 0xd8, 0x03, 0x00, 0xf8, 0x03, 0x00, 0x38, 0x03, 0x00, 0x18, 0x3f, 
-   0xff, 0xf8, 0x3f, 0xff, 0xf8, 0x30, 0x00, 0x18, 0x00, 0x00, 0xf0, 0x00, 0x07, 0x80, 0x00, 0x3c, 
-   0x00, 0x01, 0xe0, 0x00, 0x03, 0x00, 0x00, 0x30, 0x00, 0x18, 0x3f, 0xff, 0xf8, 0x3f, 0xff, 0xf8, 
-   0x00, 0x0c, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0xe0, 0x00, 0x00, 0x30, 0x00, 0x00, 0xf0, 0x00, 
-   0x03, 0x80, 0x00, 0x0e, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 
-   0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 
-   0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x18, 0x00, 
-   0x00, 0x30, 0x00, 0x00, 0x20, 0x01, 0xe3, 0x00, 0x03, 0xe3, 0x00, 0x03, 0x31, 0x80, 0x03, 0x31, 
-   0x80, 0x03, 0x11, 0x80, 0x01, 0x11, 0x80, 0x01, 0x91, 0x80, 0x01, 0xff, 0x00, 0x03, 0xff, 0x00, 
-   0x03, 0x00, 0x00, 0x03, 0xff, 0xf8, 0x03, 0xff, 0xf8, 0x01, 0x83, 0x00, 0x03, 0x01, 0x80, 0x03, 
-   0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x01, 0x83, 0x80, 0x01, 0xff, 0x00, 0x00, 0x7c, 
-   0x00, 0x00, 0x7c, 0x00, 0x01, 0xff, 0x00, 0x03, 0x83, 0x00, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 
-   0x03, 0x01, 0x80, 0x03, 0x81, 0x80, 0x01, 0xc3, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x7c, 0x00, 0x01, 
-   0xff, 0x00, 0x03, 0x83, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x01, 0x83, 
-   0x00, 0x03, 0xff, 0xf8, 0x03, 0xff, 0xf8, 0x00, 0x7c, 0x00, 0x01, 0xff, 0x00, 0x03, 0x9b, 0x80, 
-   0x03, 0x19, 0x80, 0x03, 0x19, 0x80, 0x03, 0x19, 0x80, 0x03, 0x9b, 0x80, 0x01, 0x9f, 0x00, 0x00, 
-   0x9c, 0x00, 0x00, 0x01, 0x80, 0x03, 0xff, 0xf0, 0x03, 0xff, 0xf8, 0x00, 0x01, 0x98, 0x08, 0x7c, 
-   0x00, 0x19, 0xff, 0x00, 0x33, 0x83, 0x80, 0x33, 0x01, 0x80, 0x33, 0x01, 0x80, 0x33, 0x01, 0x80, 
-   0x39, 0x83, 0x00, 0x1f, 0xff, 0x80, 0x0f, 0xff, 0x80, 0x03, 0xff, 0xf8, 0x03, 0xff, 0xf8, 0x00, 
-   0x02, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x03, 0x80, 0x03, 0xff, 
-   0x80, 0x03, 0xff, 0x00, 0x03, 0xff, 0x98, 0x03, 0xff, 0x98, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 
-   0x3f, 0xff, 0x98, 0x1f, 0xff, 0x98, 0x03, 0xff, 0xf8, 0x03, 0xff, 0xf8, 0x00, 0x18, 0x00, 0x00, 
-   0x0c, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x73, 0x00, 0x01, 0xe1, 0x80, 0x03, 0x80, 0x80, 0x02, 0x00, 
-   0x00, 0x03, 0xff, 0xf8, 0x03, 0xff, 0xf8, 0x03, 0xff, 0x80, 0x03, 0xff, 0x80, 0x00, 0x03, 0x00, 
-   0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x03, 0xff, 0x80, 0x03, 0xfe, 0x00, 0x00, 
-   0x03, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x03, 0xff, 0x80, 0x03, 0xff, 
-   0x00, 0x03, 0xff, 0x80, 0x03, 0xff, 0x80, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x80, 
-   0x00, 0x01, 0x80, 0x00, 0x03, 0x80, 0x03, 0xff, 0x80, 0x03, 0xff, 0x00, 0x00, 0x7c, 0x00, 0x01, 
-   0xff, 0x00, 0x03, 0x83, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x83, 
-   0x80, 0x01, 0xff, 0x00, 0x00, 0x7c, 0x00, 0x1f, 0xff, 0x80, 0x1f, 0xff, 0x80, 0x01, 0x83, 0x00, 
-   0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x01, 0x83, 0x00, 0x01, 
-   0xff, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x7c, 0x00, 0x01, 0xff, 0x00, 0x03, 0x83, 0x80, 0x03, 0x01, 
-   0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x01, 0x83, 0x00, 0x1f, 0xff, 0x80, 0x1f, 0xff, 0x80, 
-   0x03, 0xff, 0x80, 0x03, 0xff, 0x80, 0x00, 0x03, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x01, 
-   0x8e, 0x00, 0x03, 0x9f, 0x00, 0x03, 0x19, 0x80, 0x03, 0x19, 0x80, 0x03, 0x31, 0x80, 0x03, 0x31, 
-   0x80, 0x01, 0xf3, 0x00, 0x00, 0xe3, 0x00, 0x00, 0x01, 0x80, 0x03, 0xff, 0xe0, 0x03, 0xff, 0xe0, 
-   0x03, 0x01, 0x80, 0x01, 0xff, 0x80, 0x03, 0xff, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0x03, 
-   0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x03, 0xff, 0x80, 0x03, 0xff, 0x80, 0x00, 0x00, 
-   0x80, 0x00, 0x07, 0x80, 0x00, 0x3f, 0x00, 0x01, 0xf0, 0x00, 0x03, 0x80, 0x00, 0x03, 0xc0, 0x00, 
-   0x00, 0xf8, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x80, 0x00, 0x01, 0x80, 0x00, 
-   0x0f, 0x80, 0x00, 0xfe, 0x00, 0x03, 0xe0, 0x00, 0x03, 0xc0, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x0f, 
-   0x80, 0x00, 0x07, 0x80, 0x00, 0x7f, 0x00, 0x03, 0xf0, 0x00, 0x03, 0x80, 0x00, 0x01, 0xf8, 0x00, 
-   0x00, 0x1f, 0x80, 0x00, 0x03, 0x80, 0x03, 0x01, 0x80, 0x01, 0x83, 0x80, 0x00, 0xee, 0x00, 0x00, 
-   0x3c, 0x00, 0x00, 0x7c, 0x00, 0x01, 0xc7, 0x00, 0x03, 0x83, 0x80, 0x02, 0x00, 0x80, 0x00, 0x00, 
-   0x80, 0x30, 0x07, 0x80, 0x30, 0x3e, 0x00, 0x39, 0xf0, 0x00, 0x1f, 0x80, 0x00, 0x03, 0xc0, 0x00, 
-   0x00, 0x78, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x03, 0x80, 0x03, 0x81, 0x80, 0x03, 0xc1, 0x80, 0x03, 
-   0x61, 0x80, 0x03, 0x31, 0x80, 0x03, 0x19, 0x80, 0x03, 0x0f, 0x80, 0x03, 0x07, 0x80, 0x03, 0x01, 
-   0x80, 0x00, 0x10, 0x00, 0x00, 0x38, 0x00, 0x1f, 0xef, 0xf0, 0x3f, 0xef, 0xf8, 0x30, 0x00, 0x18, 
-   0x3f, 0xff, 0xf8, 0x3f, 0xff, 0xf8, 0x30, 0x00, 0x18, 0x3f, 0xef, 0xf8, 0x1f, 0xef, 0xf0, 0x00, 
-   0x38, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0c, 
-   0x00, 0x00, 0x08, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x0c, 0x00 };
+   0x00, 0x02, 0x05, 0xf8, 0xf8, 0x3f, 0x3f, 0x03, 0x03, 0x05, 0x05, 0xf0, 0xf0, 0x00, 0xf0, 0xf0, 
+   0x01, 0x41, 0x00, 0x01, 0x45, 0x0b, 0x00, 0x00, 0xc2, 0x80, 0x11, 0xf0, 0x90, 0x80, 0x80, 0xf0, 
+   0x90, 0x80, 0x30, 0x31, 0xf1, 0xff, 0x33, 0x31, 0xf1, 0xff, 0x33, 0x31, 0x01, 0x41, 0x00, 0x03, 
+   0x42, 0x00, 0x03, 0x43, 0x0a, 0x1d, 0xe0, 0xf0, 0x38, 0x18, 0xfc, 0x18, 0x18, 0x30, 0xf0, 0xe0, 
+   0xc3, 0xc7, 0x86, 0x0c, 0xff, 0x0c, 0x08, 0x98, 0xf8, 0xf0, 0x00, 0x01, 0x03, 0x03, 0x07, 0x03, 
+   0x03, 0x01, 0x01, 0x00, 0x11, 0x01, 0x80, 0xc0, 0xc2, 0x60, 0x01, 0xc0, 0x80, 0x42, 0x01, 0x80, 
+   0x60, 0x44, 0x01, 0x03, 0x07, 0xc2, 0x0c, 0x0b, 0x07, 0xc3, 0x30, 0x0c, 0xc6, 0xe1, 0x70, 0x30, 
+   0x30, 0x70, 0xe0, 0xc0, 0x43, 0x01, 0x04, 0x03, 0x42, 0x07, 0x01, 0x03, 0x07, 0x06, 0x06, 0x07, 
+   0x03, 0x01, 0x0c, 0x41, 0x01, 0xc0, 0xe0, 0xc2, 0x30, 0x01, 0xe0, 0xc0, 0x42, 0x0a, 0xf0, 0xf8, 
+   0x99, 0x0f, 0x06, 0x0e, 0x1a, 0xb3, 0xe1, 0xf8, 0x18, 0x41, 0x00, 0x01, 0xc4, 0x03, 0x04, 0x01, 
+   0x00, 0x01, 0x03, 0x02, 0x02, 0x02, 0xf0, 0xf0, 0x01, 0x42, 0x05, 0x06, 0x00, 0x80, 0xe0, 0x18, 
+   0x00, 0xfe, 0xff, 0x43, 0x03, 0x03, 0x0e, 0x38, 0x20, 0x05, 0x03, 0x00, 0x18, 0xe0, 0x80, 0x43, 
+   0x06, 0xff, 0xfe, 0x20, 0x38, 0x0e, 0x03, 0x00, 0x05, 0x08, 0x20, 0xa0, 0x78, 0xa0, 0x20, 0x00, 
+   0x01, 0x00, 0x01, 0x45, 0x08, 0x47, 0xc2, 0x30, 0x01, 0xfe, 0xfe, 0xc2, 0x30, 0x42, 0x01, 0x03, 
+   0x03, 0x42, 0x02, 0x43, 0x01, 0x13, 0x0f, 0x05, 0x44, 0xc4, 0x18, 0x44, 0x02, 0x43, 0x01, 0x03, 
+   0x03, 0x05, 0x41, 0x05, 0x80, 0xf0, 0x18, 0xe0, 0x3c, 0x07, 0x41, 0x00, 0x01, 0x43, 0x09, 0x02, 
+   0x80, 0xe0, 0xf0, 0xc2, 0x30, 0x05, 0xf0, 0xe0, 0x80, 0x7f, 0xff, 0xc0, 0x42, 0x04, 0xc0, 0xff, 
+   0x7f, 0x00, 0x01, 0xc4, 0x03, 0x01, 0x01, 0x00, 0x04, 0x03, 0xc0, 0xc0, 0xe0, 0xf0, 0x41, 0x81, 
+   0x41, 0x01, 0x03, 0x03, 0x09, 0x02, 0xc0, 0xe0, 0x70, 0xc2, 0x30, 0x0a, 0x70, 0xe0, 0xc0, 0x80, 
+   0xc0, 0x60, 0x30, 0x18, 0x18, 0x0c, 0x07, 0xc9, 0x03, 0x09, 0x02, 0xc0, 0xe0, 0x70, 0xc2, 0x30, 
+   0x01, 0x70, 0xe0, 0xc2, 0xc0, 0x08, 0x80, 0x00, 0x06, 0x06, 0x8e, 0xff, 0xf9, 0x00, 0x01, 0xc4, 
+   0x03, 0x01, 0x01, 0x00, 0x08, 0x42, 0x09, 0x80, 0xc0, 0xf0, 0xf0, 0x00, 0x70, 0x6c, 0x62, 0x61, 
+   0x60, 0x81, 0x00, 0x60, 0x44, 0x02, 0x03, 0x03, 0x00, 0x09, 0x02, 0x00, 0xf0, 0xf0, 0xc4, 0x30, 
+   0x03, 0x00, 0x87, 0x87, 0x06, 0xc2, 0x03, 0x04, 0x87, 0xfe, 0x7c, 0x00, 0x01, 0xc4, 0x03, 0x01, 
+   0x01, 0x00, 0x09, 0x02, 0x00, 0xc0, 0xe0, 0xc2, 0x30, 0x05, 0x70, 0xe0, 0x80, 0x7f, 0xff, 0x8c, 
+   0xc2, 0x06, 0x04, 0x8e, 0xfc, 0xf8, 0x00, 0x01, 0xc4, 0x03, 0x01, 0x01, 0x00, 0x09, 0xc5, 0x30, 
+   0x02, 0xb0, 0xf0, 0x30, 0x42, 0x03, 0xe0, 0x78, 0x0e, 0x03, 0x43, 0x01, 0x03, 0x03, 0x44, 0x09, 
+   0x02, 0x00, 0xc0, 0xe0, 0xc2, 0x30, 0x05, 0xe0, 0xc0, 0x00, 0x70, 0xf9, 0x8f, 0xc2, 0x06, 0x05, 
+   0x8f, 0xf9, 0x70, 0x00, 0x01, 0x01, 0xc2, 0x03, 0x02, 0x01, 0x01, 0x00, 0x09, 0x02, 0xc0, 0xe0, 
+   0x70, 0xc2, 0x30, 0x05, 0x70, 0xe0, 0x80, 0x87, 0x8f, 0x9c, 0xc2, 0x18, 0x04, 0xcc, 0xff, 0x3f, 
+   0x00, 0x01, 0xc3, 0x03, 0x00, 0x01, 0x41, 0x02, 0x05, 0x80, 0x80, 0x01, 0x01, 0x03, 0x03, 0x02, 
+   0x41, 0x03, 0x03, 0x03, 0x13, 0x0f, 0x0a, 0x49, 0x09, 0x30, 0x70, 0x78, 0x48, 0xc8, 0x8c, 0x84, 
+   0x86, 0x02, 0x03, 0x45, 0xc2, 0x01, 0x00, 0x03, 0x0a, 0x49, 0xc9, 0xcc, 0x49, 0x0a, 0x49, 0x0a, 
+   0x02, 0x06, 0x86, 0x84, 0x8c, 0xc8, 0x58, 0x70, 0x30, 0x30, 0x03, 0xc2, 0x01, 0x45, 0x08, 0x01, 
+   0x60, 0x70, 0xc2, 0x18, 0x02, 0x38, 0xf0, 0xe0, 0x42, 0x04, 0x30, 0x3c, 0x06, 0x03, 0x01, 0x42, 
+   0x01, 0x03, 0x03, 0x42, 0x12, 0x06, 0x00, 0x80, 0xc0, 0xe0, 0x70, 0x30, 0x38, 0xc3, 0x98, 0x1e, 
+   0x18, 0x30, 0x30, 0x60, 0xe0, 0xc0, 0x00, 0x7c, 0xff, 0x83, 0x00, 0x7c, 0xfe, 0xc7, 0x83, 0x81, 
+   0xc1, 0xe1, 0xfe, 0x8f, 0x80, 0xc0, 0xe1, 0x7f, 0x1f, 0x00, 0x01, 0x07, 0x06, 0x0c, 0x0c, 0xc2, 
+   0x19, 0x05, 0x18, 0x18, 0x19, 0x09, 0x01, 0x01, 0x42, 0x0d, 0x43, 0x04, 0xc0, 0xf8, 0x38, 0xf8, 
+   0xe0, 0x44, 0x03, 0x80, 0xf0, 0x7e, 0x37, 0xc2, 0x30, 0x07, 0x37, 0x3f, 0xf8, 0xc0, 0x00, 0x02, 
+   0x03, 0x01, 0x46, 0x02, 0x01, 0x03, 0x03, 0x0b, 0x01, 0xf8, 0xf8, 0xc4, 0x18, 0x03, 0x38, 0xf0, 
+   0xe0, 0x00, 0x81, 0xc4, 0x06, 0x03, 0x07, 0x8d, 0xf9, 0xf0, 0xc8, 0x03, 0x01, 0x01, 0x00, 0x0c, 
+   0x03, 0x80, 0xe0, 0xf0, 0x30, 0xc4, 0x18, 0x06, 0x30, 0x70, 0x40, 0x3f, 0xff, 0xe0, 0x80, 0x44, 
+   0x02, 0xc0, 0xe0, 0x60, 0x41, 0x01, 0x01, 0x01, 0xc4, 0x03, 0x02, 0x01, 0x01, 0x00, 0x0b, 0x01, 
+   0xf8, 0xf8, 0xc4, 0x18, 0x03, 0x38, 0x70, 0xe0, 0x80, 0x81, 0x44, 0x03, 0x80, 0xc0, 0xff, 0x3f, 
+   0xc7, 0x03, 0x00, 0x01, 0x41, 0x0a, 0x01, 0xf8, 0xf8, 0xc7, 0x18, 0x81, 0xc6, 0x06, 0x00, 0x00, 
+   0xc9, 0x03, 0x09, 0x01, 0xf8, 0xf8, 0xc6, 0x18, 0x81, 0xc5, 0x06, 0x02, 0x00, 0x03, 0x03, 0x46, 
+   0x0d, 0x04, 0x00, 0xc0, 0xf0, 0x30, 0x38, 0xc4, 0x18, 0x07, 0x30, 0x70, 0x40, 0x3f, 0xff, 0xe0, 
+   0x80, 0x80, 0x41, 0x05, 0x0c, 0x0c, 0x8c, 0xcc, 0xfc, 0xfc, 0x41, 0x01, 0x01, 0x01, 0xc4, 0x03, 
+   0x03, 0x01, 0x00, 0x01, 0x03, 0x0b, 0x01, 0xf8, 0xf8, 0x46, 0x01, 0xf8, 0xf8, 0x81, 0xc6, 0x06, 
+   0x81, 0x01, 0x03, 0x03, 0x46, 0x01, 0x03, 0x03, 0x02, 0x01, 0xf8, 0xf8, 0x81, 0x01, 0x03, 0x03, 
+   0x08, 0x45, 0x04, 0xf8, 0xf8, 0xe0, 0xe0, 0x80, 0x41, 0x00, 0x80, 0x81, 0x01, 0x00, 0x01, 0xc3, 
+   0x03, 0x01, 0x01, 0x00, 0x0b, 0x01, 0xf8, 0xf8, 0x42, 0x05, 0x80, 0xc0, 0x60, 0x30, 0x18, 0x08, 
+   0x81, 0x0a, 0x0c, 0x06, 0x03, 0x0f, 0x1c, 0x70, 0xe0, 0x80, 0x00, 0x03, 0x03, 0x46, 0x01, 0x03, 
+   0x03, 0x09, 0x01, 0xf8, 0xf8, 0x46, 0x81, 0x46, 0xc8, 0x03, 0x0e, 0x03, 0xf8, 0xf8, 0x78, 0xe0, 
+   0x45, 0x03, 0xe0, 0x78, 0xf8, 0xf8, 0x81, 0x09, 0x00, 0x03, 0x1f, 0xf8, 0xc0, 0x80, 0xf8, 0x1f, 
+   0x03, 0x00, 0x81, 0x01, 0x03, 0x03, 0x43, 0x01, 0x03, 0x03, 0x43, 0x01, 0x03, 0x03, 0x0b, 0x04, 
+   0xf8, 0xf8, 0x78, 0xe0, 0x80, 0x43, 0x01, 0xf8, 0xf8, 0x81, 0x06, 0x00, 0x01, 0x03, 0x0e, 0x38, 
+   0xe0, 0xc0, 0x81, 0x01, 0x03, 0x03, 0x45, 0xc2, 0x03, 0x0e, 0x04, 0x00, 0xc0, 0xe0, 0x30, 0x38, 
+   0xc3, 0x18, 0x09, 0x38, 0x30, 0xe0, 0xc0, 0x80, 0x1f, 0x7f, 0xe0, 0x80, 0x80, 0x43, 0x04, 0x80, 
+   0x80, 0xe0, 0x7f, 0x3f, 0x42, 0x00, 0x01, 0xc5, 0x03, 0x00, 0x01, 0x42, 0x0a, 0x01, 0xf8, 0xf8, 
+   0xc4, 0x18, 0x02, 0x38, 0xf0, 0xe0, 0x81, 0xc4, 0x0c, 0x01, 0x0e, 0x07, 0xc2, 0x03, 0x47, 0x0e, 
+   0x04, 0x00, 0x80, 0xc0, 0x60, 0x70, 0xc3, 0x30, 0x07, 0x70, 0x60, 0xc0, 0x80, 0x00, 0x3e, 0xff, 
+   0xc1, 0x44, 0x05, 0x80, 0x80, 0x00, 0xc1, 0xff, 0x3f, 0x41, 0x02, 0x01, 0x03, 0x07, 0xc3, 0x06, 
+   0x04, 0x03, 0x03, 0x07, 0x0e, 0x00, 0x0c, 0x01, 0xf8, 0xf8, 0xc5, 0x18, 0x03, 0x38, 0xf0, 0xe0, 
+   0x00, 0x81, 0xc5, 0x0c, 0x05, 0x1e, 0xfb, 0xf1, 0x00, 0x03, 0x03, 0x46, 0x02, 0x03, 0x03, 0x02, 
+   0x0c, 0x02, 0xe0, 0xf0, 0x30, 0xc5, 0x18, 0x08, 0x30, 0x70, 0x60, 0x61, 0xe3, 0x87, 0x86, 0x06, 
+   0x04, 0xc2, 0x0c, 0x05, 0x98, 0xf8, 0x70, 0x00, 0x01, 0x01, 0xc5, 0x03, 0x02, 0x01, 0x01, 0x00, 
+   0x0a, 0xc3, 0x18, 0x01, 0xf8, 0xf8, 0xc3, 0x18, 0x43, 0x81, 0x47, 0x01, 0x03, 0x03, 0x43, 0x0b, 
+   0x01, 0xf8, 0xf8, 0x46, 0x04, 0xf8, 0xf8, 0x7f, 0xff, 0x80, 0x44, 0x05, 0x80, 0xff, 0x7f, 0x00, 
+   0x01, 0x01, 0xc4, 0x03, 0x02, 0x01, 0x01, 0x00, 0x0c, 0x03, 0x08, 0x38, 0xf0, 0x80, 0x44, 0x02, 
+   0x80, 0xf8, 0x38, 0x41, 0x08, 0x01, 0x0f, 0x7c, 0xe0, 0x80, 0xe0, 0x7c, 0x0f, 0x01, 0x45, 0xc2, 
+   0x03, 0x43, 0x12, 0x02, 0x08, 0xf8, 0xf0, 0x43, 0x04, 0xc0, 0xf8, 0x78, 0xf0, 0x80, 0x42, 0x02, 
+   0x80, 0xf8, 0x78, 0x41, 0x0e, 0x0f, 0xff, 0xe0, 0xe0, 0xfc, 0x3f, 0x03, 0x00, 0x03, 0x3f, 0xf8, 
+   0x80, 0xf0, 0x7f, 0x07, 0x44, 0x02, 0x03, 0x03, 0x01, 0x44, 0x02, 0x01, 0x03, 0x03, 0x42, 0x0c, 
+   0x04, 0x08, 0x38, 0x70, 0xc0, 0x80, 0x41, 0x03, 0xc0, 0xf0, 0x38, 0x18, 0x41, 0x08, 0x80, 0xe0, 
+   0x71, 0x1f, 0x0e, 0x1f, 0x71, 0xe0, 0xc0, 0x41, 0x02, 0x03, 0x03, 0x01, 0x45, 0x02, 0x03, 0x03, 
+   0x02, 0x0c, 0x03, 0x18, 0x38, 0xf0, 0xc0, 0x43, 0x03, 0xc0, 0xf0, 0x38, 0x18, 0x42, 0x05, 0x03, 
+   0x07, 0xfe, 0xfe, 0x07, 0x03, 0x47, 0x01, 0x03, 0x03, 0x44, 0x0b, 0xc5, 0x18, 0x0c, 0x98, 0xd8, 
+   0xf8, 0x38, 0x18, 0x80, 0xc0, 0x70, 0x38, 0x1c, 0x0e, 0x03, 0x01, 0x42, 0xca, 0x03, 0x03, 0x02, 
+   0xf8, 0xf8, 0x18, 0x81, 0x03, 0x00, 0x3f, 0x3f, 0x30, 0x05, 0x01, 0xf0, 0x80, 0x43, 0x02, 0x07, 
+   0x3c, 0xe0, 0x43, 0x01, 0x01, 0x03, 0x03, 0x03, 0x18, 0xf8, 0xf8, 0x00, 0x81, 0x02, 0x30, 0x3f, 
+   0x3f, 0x07, 0x41, 0x07, 0xe0, 0x30, 0xf0, 0x80, 0x00, 0x0c, 0x07, 0x01, 0x41, 0x01, 0x03, 0x0e, 
+   0x46, 0x0c, 0x57, 0xcb, 0x20, 0x04, 0x03, 0x08, 0x18, 0x30, 0x20, 0x47, 0x0a, 0x41, 0xc4, 0x80, 
+   0x42, 0x06, 0xe3, 0xe3, 0x31, 0x31, 0x11, 0x11, 0x91, 0x81, 0x01, 0x00, 0x01, 0xc3, 0x03, 0xc2, 
+   0x01, 0x01, 0x03, 0x03, 0x0a, 0x02, 0xf8, 0xf8, 0x00, 0xc4, 0x80, 0x41, 0x81, 0x00, 0x83, 0xc3, 
+   0x01, 0x05, 0x83, 0xff, 0x7c, 0x03, 0x03, 0x01, 0xc3, 0x03, 0x02, 0x01, 0x01, 0x00, 0x09, 0x42, 
+   0xc3, 0x80, 0x41, 0x02, 0x7c, 0xff, 0x83, 0xc2, 0x01, 0x04, 0x81, 0xc3, 0xc2, 0x00, 0x01, 0xc4, 
+   0x03, 0x01, 0x01, 0x00, 0x09, 0x41, 0xc3, 0x80, 0x05, 0x00, 0xf8, 0xf8, 0x7c, 0xff, 0x83, 0xc2, 
+   0x01, 0x00, 0x83, 0x81, 0x01, 0x00, 0x01, 0xc3, 0x03, 0x02, 0x01, 0x03, 0x03, 0x09, 0x41, 0xc4, 
+   0x80, 0x41, 0x02, 0x7c, 0xff, 0x9b, 0xc2, 0x19, 0x04, 0x9b, 0x9f, 0x9c, 0x00, 0x01, 0xc4, 0x03, 
+   0x01, 0x01, 0x00, 0x04, 0x04, 0x80, 0xf0, 0xf8, 0x98, 0x01, 0x81, 0x04, 0x01, 0x00, 0x03, 0x03, 
+   0x00, 0x09, 0x41, 0xc3, 0x80, 0x05, 0x00, 0x80, 0x80, 0x7c, 0xff, 0x83, 0xc2, 0x01, 0x00, 0x83, 
+   0x81, 0x01, 0x08, 0x19, 0xc3, 0x33, 0x02, 0x39, 0x1f, 0x0f, 0x09, 0x02, 0xf8, 0xf8, 0x00, 0xc4, 
+   0x80, 0x00, 0x00, 0x81, 0x00, 0x02, 0xc2, 0x01, 0x00, 0x03, 0x81, 0x01, 0x03, 0x03, 0x44, 0x01, 
+   0x03, 0x03, 0x02, 0x01, 0x98, 0x98, 0x81, 0x01, 0x03, 0x03, 0x04, 0x41, 0x01, 0x98, 0x98, 0x41, 
+   0x81, 0x03, 0x30, 0x30, 0x3f, 0x1f, 0x09, 0x01, 0xf8, 0xf8, 0x43, 0x02, 0x80, 0x80, 0x00, 0x81, 
+   0x08, 0x18, 0x0c, 0x3e, 0x73, 0xe1, 0x80, 0x00, 0x03, 0x03, 0x43, 0x02, 0x01, 0x03, 0x02, 0x02, 
+   0x01, 0xf8, 0xf8, 0x81, 0x01, 0x03, 0x03, 0x0e, 0x02, 0x80, 0x80, 0x00, 0xc3, 0x80, 0x41, 0xc3, 
+   0x80, 0x00, 0x00, 0x81, 0x00, 0x03, 0xc2, 0x01, 0x02, 0xff, 0xfe, 0x03, 0xc2, 0x01, 0x81, 0x01, 
+   0x03, 0x03, 0x43, 0x01, 0x03, 0x03, 0x43, 0x01, 0x03, 0x03, 0x09, 0x01, 0x80, 0x80, 0x41, 0xc3, 
+   0x80, 0x00, 0x00, 0x81, 0x00, 0x02, 0xc2, 0x01, 0x00, 0x03, 0x81, 0x01, 0x03, 0x03, 0x44, 0x01, 
+   0x03, 0x03, 0x09, 0x41, 0xc4, 0x80, 0x41, 0x02, 0x7c, 0xff, 0x83, 0xc2, 0x01, 0x04, 0x83, 0xff, 
+   0x7c, 0x00, 0x01, 0xc4, 0x03, 0x01, 0x01, 0x00, 0x0a, 0x02, 0x80, 0x80, 0x00, 0xc3, 0x80, 0x42, 
+   0x81, 0x00, 0x83, 0xc3, 0x01, 0x05, 0x83, 0xff, 0x7c, 0x1f, 0x1f, 0x01, 0xc3, 0x03, 0x02, 0x01, 
+   0x01, 0x00, 0x09, 0x41, 0xc3, 0x80, 0x05, 0x00, 0x80, 0x80, 0x7c, 0xff, 0x83, 0xc2, 0x01, 0x00, 
+   0x83, 0x81, 0x01, 0x00, 0x01, 0xc3, 0x03, 0x02, 0x01, 0x1f, 0x1f, 0x05, 0x04, 0x80, 0x80, 0x00, 
+   0x80, 0x80, 0x81, 0x04, 0x03, 0x01, 0x01, 0x03, 0x03, 0x42, 0x08, 0x41, 0xc3, 0x80, 0x41, 0x08, 
+   0x8e, 0x9f, 0x19, 0x19, 0x31, 0x31, 0xf3, 0xe3, 0x01, 0xc4, 0x03, 0x01, 0x01, 0x00, 0x04, 0x04, 
+   0x80, 0xe0, 0xe0, 0x80, 0x01, 0x81, 0x01, 0x01, 0x00, 0xc2, 0x03, 0x09, 0x01, 0x80, 0x80, 0x44, 
+   0x01, 0x80, 0x80, 0x81, 0x00, 0x80, 0x42, 0x00, 0x80, 0x81, 0x00, 0x01, 0xc3, 0x03, 0x03, 0x01, 
+   0x00, 0x03, 0x03, 0x0a, 0x01, 0x80, 0x80, 0x45, 0x0a, 0x80, 0x80, 0x00, 0x07, 0x3f, 0xf0, 0x80, 
+   0xc0, 0xf8, 0x1f, 0x03, 0x43, 0x02, 0x01, 0x03, 0x03, 0x43, 0x0e, 0x01, 0x80, 0x80, 0x43, 0x01, 
+   0x80, 0x80, 0x43, 0x0f, 0x80, 0x80, 0x01, 0x0f, 0xfe, 0xe0, 0xc0, 0xfc, 0x0f, 0x07, 0x7f, 0xf0, 
+   0x80, 0xf8, 0x1f, 0x03, 0x42, 0x01, 0x03, 0x03, 0x43, 0x02, 0x03, 0x03, 0x01, 0x41, 0x08, 0x01, 
+   0x80, 0x80, 0x43, 0x0b, 0x80, 0x80, 0x01, 0x83, 0xee, 0x3c, 0x7c, 0xc7, 0x83, 0x00, 0x03, 0x01, 
+   0x42, 0x02, 0x01, 0x03, 0x02, 0x09, 0x01, 0x80, 0x80, 0x45, 0x0f, 0x80, 0x00, 0x07, 0x3e, 0xf0, 
+   0x80, 0xc0, 0x78, 0x1f, 0x03, 0x00, 0x30, 0x30, 0x39, 0x1f, 0x03, 0x42, 0x08, 0xc7, 0x80, 0x07, 
+   0x81, 0xc1, 0x61, 0x31, 0x19, 0x0f, 0x07, 0x01, 0xc7, 0x03, 0x05, 0x41, 0x06, 0xf0, 0xf8, 0x18, 
+   0x10, 0x38, 0xef, 0xef, 0x42, 0x02, 0x1f, 0x3f, 0x30, 0x02, 0x01, 0xf8, 0xf8, 0x81, 0x01, 0x3f, 
+   0x3f, 0x05, 0x02, 0x18, 0xf8, 0xf0, 0x42, 0x06, 0xef, 0xef, 0x38, 0x10, 0x30, 0x3f, 0x1f, 0x41, 
+   0x08, 0x47, 0x07, 0x0c, 0x06, 0x06, 0x0c, 0x08, 0x18, 0x18, 0x0c, 0x47 };
 
 static const FontChar freesans20_chars[] = {
-   {    0,  0,  5,  5 },      // ' '
-   {    0,  6,  3,  7 },      // '!'
-   {    6, 15,  1,  7 },      // '"'
-   {   21, 33,  0, 11 },      // '#'
-   {   54, 30,  1, 11 },      // '$'
-   {   84, 51,  1, 18 },      // '%'
-   {  135, 36,  1, 13 },      // '&'
-   {  171,  6,  1,  4 },      // '''
-   {  177, 15,  1,  7 },      // '('
-   {  192, 15,  1,  7 },      // ')'
-   {  207, 15,  1,  8 },      // '*'
-   {  222, 24,  2, 12 },      // '+'
-   {  246,  6,  2,  6 },      // ','
-   {  252, 15,  1,  7 },      // '-'
-   {  267,  6,  2,  5 },      // '.'
-   {  273, 15,  0,  7 },      // '/'
-   {  288, 27,  1, 11 },      // '0'
-   {  315, 12,  3, 11 },      // '1'
-   {  327, 27,  1, 11 },      // '2'
-   {  354, 27,  1, 11 },      // '3'
-   {  381, 24,  2, 11 },      // '4'
-   {  405, 27,  1, 11 },      // '5'
-   {  432, 27,  1, 11 },      // '6'
-   {  459, 27,  1, 11 },      // '7'
-   {  486, 27,  1, 11 },      // '8'
-   {  513, 27,  1, 11 },      // '9'
-   {  540,  6,  2,  5 },      // ':'
-   {  546,  6,  2,  5 },      // ';'
-   {  552, 30,  1, 12 },      // '<'
-   {  582, 30,  1, 12 },      // '='
-   {  612, 30,  1, 12 },      // '>'
-   {  642, 24,  2, 11 },      // '?'
-   {  666, 54,  1, 20 },      // '@'
-   {  720, 39,  0, 14 },      // 'A'
-   {  759, 33,  2, 13 },      // 'B'
-   {  792, 36,  1, 14 },      // 'C'
-   {  828, 33,  2, 14 },      // 'D'
-   {  861, 30,  2, 13 },      // 'E'
-   {  891, 27,  2, 12 },      // 'F'
-   {  918, 39,  1, 15 },      // 'G'
-   {  957, 33,  2, 14 },      // 'H'
-   {  990,  6,  2,  6 },      // 'I'
-   {  996, 24,  1, 11 },      // 'J'
-   { 1020, 33,  2, 14 },      // 'K'
-   { 1053, 27,  2, 11 },      // 'L'
-   { 1080, 42,  2, 17 },      // 'M'
-   { 1122, 33,  2, 15 },      // 'N'
-   { 1155, 42,  1, 16 },      // 'O'
-   { 1197, 30,  2, 13 },      // 'P'
-   { 1227, 42,  1, 16 },      // 'Q'
-   { 1269, 36,  2, 14 },      // 'R'
-   { 1305, 36,  1, 13 },      // 'S'
-   { 1341, 30,  1, 13 },      // 'T'
-   { 1371, 33,  2, 14 },      // 'U'
-   { 1404, 36,  0, 13 },      // 'V'
-   { 1440, 54,  0, 19 },      // 'W'
-   { 1494, 36,  1, 13 },      // 'X'
-   { 1530, 36,  1, 14 },      // 'Y'
-   { 1566, 33,  1, 12 },      // 'Z'
-   { 1599,  9,  1,  6 },      // '['
-   { 1608, 15,  0,  7 },      // '\'
-   { 1623,  9,  0,  6 },      // ']'
-   { 1632, 21,  1,  9 },      // '^'
-   { 1653, 36,  0, 13 },      // '_'
-   { 1689, 12,  0,  5 },      // '`'
-   { 1701, 30,  1, 11 },      // 'a'
-   { 1731, 30,  1, 11 },      // 'b'
-   { 1761, 27,  1, 10 },      // 'c'
-   { 1788, 27,  1, 11 },      // 'd'
-   { 1815, 27,  1, 11 },      // 'e'
-   { 1842, 12,  1,  6 },      // 'f'
-   { 1854, 27,  1, 11 },      // 'g'
-   { 1881, 27,  1, 11 },      // 'h'
-   { 1908,  6,  1,  4 },      // 'i'
-   { 1914, 12,  0,  5 },      // 'j'
-   { 1926, 27,  1, 11 },      // 'k'
-   { 1953,  6,  1,  4 },      // 'l'
-   { 1959, 42,  1, 16 },      // 'm'
-   { 2001, 27,  1, 11 },      // 'n'
-   { 2028, 27,  1, 11 },      // 'o'
-   { 2055, 30,  1, 11 },      // 'p'
-   { 2085, 27,  1, 11 },      // 'q'
-   { 2112, 15,  1,  7 },      // 'r'
-   { 2127, 24,  1, 10 },      // 's'
-   { 2151, 12,  1,  6 },      // 't'
-   { 2163, 27,  1, 11 },      // 'u'
-   { 2190, 30,  0, 10 },      // 'v'
-   { 2220, 42,  0, 15 },      // 'w'
-   { 2262, 24,  1, 10 },      // 'x'
-   { 2286, 27,  0, 10 },      // 'y'
-   { 2313, 24,  1, 10 },      // 'z'
-   { 2337, 15,  0,  7 },      // '{'
-   { 2352,  6,  2,  5 },      // '|'
-   { 2358, 15,  2,  7 },      // '}'
-   { 2373, 24,  1, 10 },      // '~'
+   {    0,  1,  5,  5 },      // ' '
+   {    1,  8,  3,  7 },      // '!'
+   {    9, 12,  1,  7 },      // '"'
+   {   21, 31,  0, 11 },      // '#'
+   {   52, 32,  1, 11 },      // '$'
+   {   84, 46,  1, 18 },      // '%'
+   {  130, 34,  1, 13 },      // '&'
+   {  164,  6,  1,  4 },      // '''
+   {  170, 15,  1,  7 },      // '('
+   {  185, 15,  1,  7 },      // ')'
+   {  200, 12,  1,  8 },      // '*'
+   {  212, 14,  2, 12 },      // '+'
+   {  226,  5,  2,  6 },      // ','
+   {  231,  5,  1,  7 },      // '-'
+   {  236,  5,  2,  5 },      // '.'
+   {  241, 13,  0,  7 },      // '/'
+   {  254, 26,  1, 11 },      // '0'
+   {  280, 12,  3, 11 },      // '1'
+   {  292, 21,  1, 11 },      // '2'
+   {  313, 27,  1, 11 },      // '3'
+   {  340, 21,  2, 11 },      // '4'
+   {  361, 25,  1, 11 },      // '5'
+   {  386, 27,  1, 11 },      // '6'
+   {  413, 18,  1, 11 },      // '7'
+   {  431, 29,  1, 11 },      // '8'
+   {  460, 27,  1, 11 },      // '9'
+   {  487,  8,  2,  5 },      // ':'
+   {  495,  7,  2,  5 },      // ';'
+   {  502, 18,  1, 12 },      // '<'
+   {  520,  5,  1, 12 },      // '='
+   {  525, 17,  1, 12 },      // '>'
+   {  542, 22,  2, 11 },      // '?'
+   {  564, 53,  1, 20 },      // '@'
+   {  617, 30,  0, 14 },      // 'A'
+   {  647, 24,  2, 13 },      // 'B'
+   {  671, 31,  1, 14 },      // 'C'
+   {  702, 23,  2, 14 },      // 'D'
+   {  725, 13,  2, 13 },      // 'E'
+   {  738, 14,  2, 12 },      // 'F'
+   {  752, 37,  1, 15 },      // 'G'
+   {  789, 19,  2, 14 },      // 'H'
+   {  808,  8,  2,  6 },      // 'I'
+   {  816, 20,  1, 11 },      // 'J'
+   {  836, 29,  2, 14 },      // 'K'
+   {  865,  9,  2, 11 },      // 'L'
+   {  874, 36,  2, 17 },      // 'M'
+   {  910, 27,  2, 15 },      // 'N'
+   {  937, 35,  1, 16 },      // 'O'
+   {  972, 19,  2, 13 },      // 'P'
+   {  991, 39,  1, 16 },      // 'Q'
+   { 1030, 26,  2, 14 },      // 'R'
+   { 1056, 32,  1, 13 },      // 'S'
+   { 1088, 15,  1, 13 },      // 'T'
+   { 1103, 25,  2, 14 },      // 'U'
+   { 1128, 26,  0, 13 },      // 'V'
+   { 1154, 45,  0, 19 },      // 'W'
+   { 1199, 34,  1, 13 },      // 'X'
+   { 1233, 25,  1, 14 },      // 'Y'
+   { 1258, 20,  1, 12 },      // 'Z'
+   { 1278, 11,  1,  6 },      // '['
+   { 1289, 13,  0,  7 },      // '\'
+   { 1302, 11,  0,  6 },      // ']'
+   { 1313, 16,  1,  9 },      // '^'
+   { 1329,  4,  0, 13 },      // '_'
+   { 1333,  7,  0,  5 },      // '`'
+   { 1340, 24,  1, 11 },      // 'a'
+   { 1364, 26,  1, 11 },      // 'b'
+   { 1390, 22,  1, 10 },      // 'c'
+   { 1412, 25,  1, 11 },      // 'd'
+   { 1437, 22,  1, 11 },      // 'e'
+   { 1459, 14,  1,  6 },      // 'f'
+   { 1473, 25,  1, 11 },      // 'g'
+   { 1498, 24,  1, 11 },      // 'h'
+   { 1522,  8,  1,  4 },      // 'i'
+   { 1530, 12,  0,  5 },      // 'j'
+   { 1542, 25,  1, 11 },      // 'k'
+   { 1567,  8,  1,  4 },      // 'l'
+   { 1575, 35,  1, 16 },      // 'm'
+   { 1610, 24,  1, 11 },      // 'n'
+   { 1634, 22,  1, 11 },      // 'o'
+   { 1656, 26,  1, 11 },      // 'p'
+   { 1682, 25,  1, 11 },      // 'q'
+   { 1707, 15,  1,  7 },      // 'r'
+   { 1722, 20,  1, 10 },      // 's'
+   { 1742, 13,  1,  6 },      // 't'
+   { 1755, 24,  1, 11 },      // 'u'
+   { 1779, 23,  0, 10 },      // 'v'
+   { 1802, 36,  0, 15 },      // 'w'
+   { 1838, 23,  1, 10 },      // 'x'
+   { 1861, 23,  0, 10 },      // 'y'
+   { 1884, 14,  1, 10 },      // 'z'
+   { 1898, 15,  0,  7 },      // '{'
+   { 1913,  8,  2,  5 },      // '|'
+   { 1921, 15,  2,  7 },      // '}'
+   { 1936, 12,  1, 10 },      // '~'
 };
 
-static const FontInfo freesans20 = { freesans20_bitmap, freesans20_chars, 22, 32, 126 };
+static const FontInfo freesans20 = { freesans20_bitmap, freesans20_chars, 22, 32, 126, FONT_FLG_RLE };
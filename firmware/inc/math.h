@@ -10,6 +10,13 @@ static inline float sqrtf( float in )
    return ret;
 }
 
+// x*y + z with a single rounding
+static inline float fmaf( float x, float y, float z )
+{
+   asm( "vfma.f32 %[acc], %[x], %[y]": [acc] "+t" (z) : [x] "t" (x), [y] "t" (y) );
+   return z;
+}
+
 static inline float fabsf( float in )
 {
    float ret;
@@ -18,6 +25,11 @@ static inline float fabsf( float in )
 }
 
 float powf( float x, float y );
+float expf( float x );
+float exp2f( float x );
+float log2f( float x );
+float atanf( float x );
+float atan2f( float y, float x );
 int isnanf( float f );
 int isinff( float f );
 float frexpf(float x, int *pw2);
@@ -26,4 +38,13 @@ float logf(float x);
 float log10f(float x);
 float floorf( float in );
 
+// Faster versions with looser limits, see math.c
+float FastExp( float x );
+float FastExp2( float x );
+float FastLog( float x );
+float FastLog2( float x );
+float FastPow( float x, float y );
+float FastAtan( float x );
+float FastAtan2( float y, float x );
+
 #endif
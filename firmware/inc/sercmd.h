@@ -5,13 +5,45 @@
 
 #include <stdint.h>
 
+// Size of each command buffer
+#define SERCMD_BUFF_LEN      200
+
+// Number of commands that can be queued on a channel using the
+// version 2 framing.  The other modes only use the first buffer.
+#define SERCMD_QUEUE_LEN     4
+
+// Number of data bytes in each frame of a bulk read
+#define SERCMD_BULK_CHUNK    128
+
 typedef struct
 {
-   uint8_t buff[200];
-   int8_t  usb;
+   uint8_t buff[SERCMD_QUEUE_LEN][SERCMD_BUFF_LEN];
+   int16_t len[SERCMD_QUEUE_LEN];
+
+   // The frame being sent is made up of the bytes in frm up to hdrLen,
+   // then srcLen bytes from src, then any remaining bytes of frm.
+   const uint8_t *src;
+   int16_t srcLen;
+   uint8_t hdrLen;
+   uint8_t frm[15];
+
+   // Bulk read in progress
+   uint32_t bulkAddr;
+   uint32_t bulkLen;
+   uint32_t bulkCRC;
+
+   int8_t  usb;                // 0 for the UART, else 1 + the USB port
    int8_t  state;
-   uint8_t flag;
+   uint16_t flag;
+   uint8_t proto;
+   uint8_t newProto;
+   uint8_t code;
+   uint8_t txBlk;
+   uint8_t rxSlot;
+   uint8_t txSlot;
+   uint8_t queued;
    int16_t cmdNdx;
+   int16_t rspNdx;
    int16_t rspLen;
 } SerCmdInfo;
 
@@ -5,10 +5,25 @@
 
 #include <stdarg.h>
 #include <stddef.h>
+#include "buffer.h"
+
+// Destination for formatted output.  The output can be split across
+// two spans, such as the free space on either side of the wrap point
+// of a circular buffer, so it can be formatted in place.
+typedef struct
+{
+   char *ptr[2];           // Where the next character in each span goes
+   int room[2];            // Space left in each span
+   int ndx;                // Span currently being written
+   int len;                // Total characters produced, including any that didn't fit
+} PrintSink;
 
 int sprintf( char *str, const char *format, ... );
 int snprintf( char *str, size_t size, const char *format, ... );
 int vsnprintf( char *str, size_t size, const char *format, va_list ap );
+void SinkInit( PrintSink *out, void *p1, int n1, void *p2, int n2 );
+int SinkPrintf( PrintSink *out, const char *format, va_list ap );
+int BuffPrintf( CircBuff *cb, const char *format, va_list ap );
 
 
 #endif
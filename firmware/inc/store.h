@@ -8,11 +8,13 @@
 
 #define CAL_POINTS         20
 
-// This structure layout of the non-volatile parameter info
-// stored in flash.
-// The structure must be exactly 512 bytes long.
+// This structure layout of the non-volatile parameter info.
+// A copy is kept in RAM and changes to it are logged to flash.
+// The structure must be exactly 256 bytes long.
 typedef struct
 {
+   // The first 8 bytes were a header in the old storage format, which
+   // kept copies of the whole structure.  They aren't logged.
    uint32_t crc;            // 32-bit CRC of remaining structure
    uint8_t  count;          // Incremented on each write. 
    uint8_t  mark;           // Used to corrupt old blocks
@@ -14,6 +14,12 @@ int UART_Recv( void );
 int UART_FlushRx( void );
 int UART_RxFull( void );
 int UART_TxFree( void );
+int UART_RxSpan( uint8_t **ptr );
+void UART_RxDone( int ct );
+int UART_TxSpan( uint8_t **ptr );
+void UART_TxDone( int ct );
 void UART_ISR( void );
+void UART_RxISR( void );
+void PollUART( void );
 
 #endif
@@ -110,6 +110,19 @@ typedef struct
    uint8_t  slave;      // Slave interface
 } __attribute__((__packed__)) USBdesc_CDC_Union;
 
+// USB interface association descriptor
+typedef struct
+{
+   uint8_t  length;     // Length of descriptor in bytes
+   uint8_t  descType;   // Descriptor type
+   uint8_t  firstIntf;  // Index of the first interface
+   uint8_t  numIntf;    // Number of interfaces
+   uint8_t  funcClass;  // Function class code
+   uint8_t  subClass;   // Function sub-class code
+   uint8_t  protocol;   // Function protocol code
+   uint8_t  nFunc;      // String index of function name
+} __attribute__((__packed__)) USBdesc_IntfAssoc;
+
 // USB string descriptor
 #define MAX_USB_STR 64
 typedef struct
@@ -119,13 +132,23 @@ typedef struct
    uint16_t chr[MAX_USB_STR];    // Unicode characters or language codes for string 0
 } __attribute__((__packed__)) USBdesc_String;
 
+// Data ports.  The CDC port is the virtual serial port and the bulk
+// port is a vendor specific interface with its own pair of endpoints.
+#define USB_PORT_CDC    0
+#define USB_PORT_BULK   1
+#define USB_NUM_PORTS   2
+
 // prototypes
 void InitUSB( void );
-void PollUSB( void );
-int USB_SendByte( uint8_t dat );
-int USB_Send( uint8_t dat[], int ct );
-int USB_Recv( void );
-int USB_TxFree( void );
+int USB_SendByte( int n, uint8_t dat );
+int USB_Send( int n, uint8_t dat[], int ct );
+int USB_Recv( int n );
+int USB_TxFree( int n );
+int USB_RxSpan( int n, uint8_t **ptr );
+void USB_RxDone( int n, int ct );
+int USB_TxSpan( int n, uint8_t **ptr );
+void USB_TxDone( int n, int ct );
+void USB_ISR( void );
 
 
 #endif
@@ -13,23 +13,30 @@ typedef struct _VarInfo
 {
    const char *name;         // Variable name.  Used to identify the variable via ASCII commands
    uint16_t id;              // Variable ID.  Used to identify the variable via binary commands
-   uint8_t size;             // Size of the variable data in bytes.
+   uint16_t size;            // Size of the variable data in bytes.
    uint8_t flags;            // Various info about variable
+   uint8_t type;             // Variable type as passed to VarInit
+   const char *units;        // Optional units string reported to the host.  Null for none
    void *ptr;                // Pointer to the variable data
 
-   // This function is called by the binary serial 'get' command.
-   // It gets the variable value and stores it in the passed buffer
-   // which has at least max bytes of space available.
+   // This function is called by the binary serial 'get' commands.
+   // It gets len bytes of the variable value starting at byte offset
+   // off and stores them in the passed buffer.
+   //
+   // The offset and length have already been checked against the
+   // variable size when this is called.  For non-array variables
+   // off is always 0 and len is the variable size.
    //
    // The function returns an error code
-   int (*get)( struct _VarInfo *info, uint8_t *buff, int max );
+   int (*get)( struct _VarInfo *info, uint8_t *buff, int off, int len );
 
    // This function is called to set a variable via the binary
-   // command.  The data to store to the variable is passed in the
-   // buffer which has at least 'len' bytes of data in it.
+   // commands.  The data to store to the variable starting at byte
+   // offset off is passed in the buffer which has len bytes of data.
+   // The offset and length are checked the same way as for get.
    //
    // The function returns an error code
-   int (*set)( struct _VarInfo *info, uint8_t *buff, int len );
+   int (*set)( struct _VarInfo *info, uint8_t *buff, int off, int len );
 
 } VarInfo;
 
@@ -39,6 +46,7 @@ typedef struct _VarInfo
 #define VAR_TYPE_ARY16          3
 #define VAR_TYPE_ARY32          4
 #define VAR_TYPE_FLOAT          5
+#define VAR_TYPE_ARYFLT         6
 
 // Flags passed to VarInit
 #define VAR_FLG_READONLY        0x01
@@ -60,16 +68,27 @@ typedef struct _VarInfo
 #define VARID_PCAL              13
 #define VARID_VIN               14
 #define VARID_FLOW              15
+#define VARID_UART_BAUD         16
+#define VARID_DISP_FRAMES       17
+#define VARID_DISP_DROPPED      18
+#define VARID_UART_DROPPED      19
 
 #define VARID_MAX               50
 
 // prototypes
 int VarInit( VarInfo *info, uint16_t id, const char *name, int type, void *ptr, uint8_t flags );
+int VarInitAry( VarInfo *info, uint16_t id, const char *name, int type, void *ptr, uint16_t count, uint8_t flags );
+int VarElemSize( VarInfo *info );
 int HandleVarGet( uint8_t *cmd, int len, int max );
 int HandleVarSet( uint8_t *cmd, int len, int max );
-int VarGet16( VarInfo *info, uint8_t *buff, int max );
-int VarGet32( VarInfo *info, uint8_t *buff, int max );
-int VarSet16( VarInfo *info, uint8_t *buff, int len );
-int VarSet32( VarInfo *info, uint8_t *buff, int len );
+int HandleVarGetPart( uint8_t *cmd, int len, int max );
+int HandleVarSetPart( uint8_t *cmd, int len, int max );
+int HandleVarList( uint8_t *cmd, int len, int max );
+int VarGet16( VarInfo *info, uint8_t *buff, int off, int len );
+int VarGet32( VarInfo *info, uint8_t *buff, int off, int len );
+int VarGetAry( VarInfo *info, uint8_t *buff, int off, int len );
+int VarSet16( VarInfo *info, uint8_t *buff, int off, int len );
+int VarSet32( VarInfo *info, uint8_t *buff, int off, int len );
+int VarSetAry( VarInfo *info, uint8_t *buff, int off, int len );
 
 #endif
@@ -0,0 +1,65 @@
+/* widget.h */
+
+#ifndef _DEF_INC_WIDGET
+#define _DEF_INC_WIDGET
+
+#include <stdint.h>
+
+#define WIDGET_TYPE_TEXT       0
+#define WIDGET_TYPE_NUMBER     1
+#define WIDGET_TYPE_CUSTOM     2
+
+typedef struct Widget Widget;
+
+// Reads the value shown by a number widget
+typedef float (*WidgetGet)( void );
+
+// Returns the state a custom widget shows.  The widget is
+// redrawn whenever this changes.
+typedef int32_t (*WidgetState)( void );
+
+// Draws a custom widget
+typedef void (*WidgetDraw)( const Widget *w );
+
+// One item on a screen.  The widget owns the rectangle given by
+// x, y, w and h and is the only thing drawn there.  A height of
+// 0 means the height of a row of text in the widget's font.
+struct Widget
+{
+   uint8_t type;         // One of the WIDGET_TYPE_ values above
+   uint8_t font;         // Font used for text
+   uint8_t x, y;         // Upper left corner
+   uint8_t w, h;         // Size in pixels
+   uint8_t digits;       // Number field width, not counting the point
+   uint8_t dec;          // Digits after the decimal point
+   const char *text;     // Static text
+   WidgetGet get;        // Number value
+   float scale;          // The number shown is (int)(get() * scale)
+   WidgetState state;    // Custom widget state
+   WidgetDraw draw;      // Custom widget draw function
+   int32_t shown;        // Value or state last drawn
+   uint8_t valid;        // Cleared to force a redraw
+};
+
+// The widget definitions below are used to fill in static widget
+// lists.  Their arguments are named after the fields they set.
+
+// Static text
+#define WIDGET_TEXT( x_, y_, w_, font_, str_ ) \
+   { .type=WIDGET_TYPE_TEXT, .font=font_, .x=x_, .y=y_, .w=w_, .text=str_ }
+
+// Fixed point readout with dec digits after the point, drawn with
+// DrawNumber.  It's only redrawn when the value shown changes.
+#define WIDGET_NUMBER( x_, y_, font_, digits_, dec_, get_, scale_ ) \
+   { .type=WIDGET_TYPE_NUMBER, .font=font_, .x=x_, .y=y_,          \
+     .digits=digits_, .dec=dec_, .get=get_, .scale=scale_ }
+
+// Graphs and anything else that draws itself
+#define WIDGET_CUSTOM( x_, y_, w_, h_, state_, draw_ ) \
+   { .type=WIDGET_TYPE_CUSTOM, .x=x_, .y=y_, .w=w_, .h=h_, .state=state_, .draw=draw_ }
+
+// prototypes
+void WidgetInvalidate( Widget *list, int ct );
+int WidgetUpdate( Widget *list, int ct );
+
+#endif
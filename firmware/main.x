@@ -3,8 +3,8 @@
  * 
  *   0x08000000 - 0x08003FFF - Boot loader
  *   0x08004000 - 0x08017FFF - code and constants
- *   0x08018000 - 0x0801EFFF - reserved for future use
- *   0x0801F000 - 0x0801FFFF - non-volatile parameter storage
+ *   0x08018000 - 0x0801DFFF - reserved for future use
+ *   0x0801E000 - 0x0801FFFF - non-volatile parameter storage
  *
  * We have 40k of SRAM: 0x20000000 - 0x20009FFF
  *
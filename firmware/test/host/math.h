@@ -0,0 +1,36 @@
+/* math.h */
+
+// Host build version of inc/math.h.
+//
+// The firmware header uses the VFP instructions vsqrt, vfma and vabs
+// for sqrtf, fmaf and fabsf.  Here those are renamed out of the way
+// and replaced with the compiler builtins, which give the same exactly
+// rounded results.  Everything else comes from the firmware header.
+
+#ifndef _DEF_INC_HOST_MATH
+#define _DEF_INC_HOST_MATH
+
+#define sqrtf   FwSqrtf
+#define fmaf    FwFmaf
+#define fabsf   FwFabsf
+#include "../../inc/math.h"
+#undef sqrtf
+#undef fmaf
+#undef fabsf
+
+static inline float sqrtf( float in )
+{
+   return __builtin_sqrtf( in );
+}
+
+static inline float fmaf( float x, float y, float z )
+{
+   return __builtin_fmaf( x, y, z );
+}
+
+static inline float fabsf( float in )
+{
+   return __builtin_fabsf( in );
+}
+
+#endif
@@ -0,0 +1,409 @@
+/* math_test.c */
+
+// Host accuracy and speed test for math.c.
+//
+// Each function is compared against the C library's double precision
+// version, and the largest error is reported in ULP (units in the last
+// place) of the correctly rounded float result, along with the input
+// where it happened.  Then each function is timed on inputs from its
+// normal operating range.
+//
+// The one argument functions are checked on every float32 input, or
+// every 97th one for a quick run.  powf and atan2f can't be swept, so
+// they're checked on a grid of special values and random pairs.
+//
+// The precise functions are checked on all inputs, including NaN,
+// infinity and denormals.  The Fast... functions are only checked over
+// the range they're documented to handle.  Errors over the limits given
+// in math.c are flagged and make the test fail.
+//
+// math.c is built with host/math.h in place of the firmware's, see
+// there for details.
+//
+// Usage:
+//   math_test [-x] [name]
+//
+//   -x       check every input.  This takes a while.
+//   name     only test the named function
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include <math.h>
+
+// The reference functions.  The C library's math.h can't be included
+// along with the firmware's, so they're declared here.
+double exp( double x );
+double exp2( double x );
+double log( double x );
+double log2( double x );
+double pow( double x, double y );
+double atan( double x );
+double atan2( double y, double x );
+double frexp( double x, int *e );
+double ldexp( double x, int e );
+
+typedef float (*FltFunc)( float );
+typedef double (*DblFunc)( double );
+typedef float (*FltFunc2)( float, float );
+typedef double (*DblFunc2)( double, double );
+
+// Which inputs a function handles
+#define DOM_ALL          0       // Everything, special values included
+#define DOM_FINITE       1       // Finite inputs
+#define DOM_EXP          2       // Finite inputs with a normal result.  For pow,
+                                 // x also has to be positive and normal.
+#define DOM_LOG          3       // Positive, normal inputs
+
+typedef struct
+{
+   const char *name;
+   FltFunc f;
+   DblFunc ref;
+   int dom;
+   double limit;                 // Documented error limit in ULP
+   float lo, hi;                 // Range of the inputs timed
+} Test1;
+
+typedef struct
+{
+   const char *name;
+   FltFunc2 f;
+   DblFunc2 ref;
+   int dom;
+   double limit;                 // Documented error limit in ULP
+   float lo, hi;                 // Range of the x inputs timed, y is -4 to 4
+} Test2;
+
+static float AtanFast( float x ){ return FastAtan( x ); }
+
+static const Test1 test1[] =
+{
+   { "exp2f",     exp2f,    exp2,  DOM_ALL,     1.5,  -100.0f,  100.0f },
+   { "expf",      expf,     exp,   DOM_ALL,     1.5,   -80.0f,   80.0f },
+   { "logf",      logf,     log,   DOM_ALL,     1.5,   1e-30f,   1e30f },
+   { "log2f",     log2f,    log2,  DOM_ALL,     1.5,   1e-30f,   1e30f },
+   { "atanf",     atanf,    atan,  DOM_ALL,     3.5,  -100.0f,  100.0f },
+   { "FastExp2",  FastExp2, exp2,  DOM_EXP,     3.0,  -100.0f,  100.0f },
+   { "FastExp",   FastExp,  exp,   DOM_EXP,     3.0,   -80.0f,   80.0f },
+   { "FastLog",   FastLog,  log,   DOM_LOG,     6.0,   1e-30f,   1e30f },
+   { "FastLog2",  FastLog2, log2,  DOM_LOG,     6.0,   1e-30f,   1e30f },
+   { "FastAtan",  AtanFast, atan,  DOM_FINITE, 12.0,  -100.0f,  100.0f },
+};
+
+static const Test2 test2[] =
+{
+   { "powf",      powf,      pow,    DOM_ALL,      1.5,    1e-3f,   1e3f },
+   { "atan2f",    atan2f,    atan2,  DOM_ALL,      3.5,  -100.0f, 100.0f },
+   { "FastPow",   FastPow,   pow,    DOM_EXP,    400.0,    1e-3f,   1e3f },
+   { "FastAtan2", FastAtan2, atan2,  DOM_FINITE,  12.0,  -100.0f, 100.0f },
+};
+
+#define ARRAY_CT(x)      (sizeof(x)/sizeof(x[0]))
+#define SAMPLE_STRIDE    97
+#define PAIR_CT          4000000
+#define FULL_PAIR_CT     40000000
+#define TIME_CT          4096
+#define TIME_REPEAT      2000
+
+// A NaN or wrong special value shows up as this many ULP
+#define BAD_ULP          1e9
+
+static uint32_t F2I( float val ){ uint32_t u; memcpy( &u, &val, 4 ); return u; }
+static float I2F( uint32_t val ){ float f; memcpy( &f, &val, 4 ); return f; }
+
+static int IsFinite( float x )
+{
+   return (F2I(x) & 0x7F800000) != 0x7F800000;
+}
+
+// Error of a result in ULP of the exact value.  Results that should be
+// NaN, infinite or zero have to be exactly that.
+static double UlpErr( float got, double ref )
+{
+   if( ref != ref )
+      return (got != got) ? 0 : BAD_ULP;
+   if( got != got )
+      return BAD_ULP;
+
+   float rf = (float)ref;
+   if( !IsFinite(rf) || !IsFinite(got) || (rf == 0.0f) )
+      return ((got == rf) && ((F2I(got) >> 31) == (F2I(rf) >> 31))) ? 0 : BAD_ULP;
+
+   int e;
+   frexp( ref, &e );
+   double ulp = ldexp( 1.0, e-24 );
+   if( ulp < ldexp( 1.0, -149 ) )
+      ulp = ldexp( 1.0, -149 );
+
+   return __builtin_fabs( (double)got - ref ) / ulp;
+}
+
+// Check whether an input is in the domain a function handles
+static int InDomain( int dom, float x, double ref )
+{
+   switch( dom )
+   {
+      case DOM_FINITE:
+         return IsFinite( x );
+
+      case DOM_EXP:
+         return IsFinite( x ) && (ref >= 0x1p-126) && (ref < 0x1p128);
+
+      case DOM_LOG:
+         return IsFinite( x ) && (F2I(x) >= 0x00800000) && (F2I(x) < 0x80000000);
+   }
+   return 1;
+}
+
+typedef struct
+{
+   double ulp;
+   float x, y;
+} Worst;
+
+// Run a sweep in a process for each CPU and combine the results.
+// sweep is called with the process number and count.
+static Worst RunSplit( Worst (*sweep)( const void *, int, int ), const void *test )
+{
+   int nproc = sysconf( _SC_NPROCESSORS_ONLN );
+   if( nproc < 1 ) nproc = 1;
+
+   int fd[2];
+   Worst worst = { 0, 0, 0 };
+   if( pipe( fd ) )
+      return worst;
+
+   for( int p=0; p<nproc; p++ )
+   {
+      if( fork() )
+         continue;
+
+      Worst w = sweep( test, p, nproc );
+      if( write( fd[1], &w, sizeof(w) ) != sizeof(w) )
+         _exit( 1 );
+      _exit( 0 );
+   }
+   close( fd[1] );
+
+   Worst w;
+   while( read( fd[0], &w, sizeof(w) ) == sizeof(w) )
+   {
+      if( w.ulp > worst.ulp )
+         worst = w;
+   }
+   close( fd[0] );
+   while( wait( 0 ) > 0 );
+
+   return worst;
+}
+
+static int fullRun;
+
+static Worst Sweep1( const void *test, int p, int nproc )
+{
+   const Test1 *t = test;
+   Worst w = { 0, 0, 0 };
+   uint64_t step = fullRun ? 1 : SAMPLE_STRIDE;
+
+   for( uint64_t i=p*step; i<0x100000000ull; i+=nproc*step )
+   {
+      float x = I2F( (uint32_t)i );
+      double ref = t->ref( x );
+      if( !InDomain( t->dom, x, ref ) )
+         continue;
+
+      double e = UlpErr( t->f( x ), ref );
+      if( e > w.ulp )
+      {
+         w.ulp = e;
+         w.x = x;
+      }
+   }
+   return w;
+}
+
+// Simple generator, so every process gets its own repeatable stream
+static uint32_t Rand( uint64_t *s )
+{
+   *s ^= *s << 13;
+   *s ^= *s >> 7;
+   *s ^= *s << 17;
+   return (uint32_t)*s;
+}
+
+// Pairs of inputs for the two argument functions.  The first ones are
+// every combination of a list of special values.  After that, x is
+// random and y is random, a small integer, a fixed point value or in
+// the range where pow's result stays in range.
+static void Pair( uint64_t *s, long i, float *x, float *y )
+{
+   static const uint32_t special[] =
+   {
+      0x00000000, 0x80000000, 0x3F800000, 0xBF800000, 0x40000000, 0xC0000000,
+      0x3F000000, 0xBF000000, 0x40400000, 0xC0400000, 0x7F800000, 0xFF800000,
+      0x7FC00000, 0x00000001, 0x80000001, 0x7F7FFFFF, 0x3F800001, 0x3F7FFFFF,
+      0x41200000, 0x3DCCCCCD, 0xBFC00000, 0x0DA24260, 0xF149F2CA,
+   };
+   const long n = ARRAY_CT(special);
+
+   if( i < n*n )
+   {
+      *x = I2F( special[i/n] );
+      *y = I2F( special[i%n] );
+      return;
+   }
+
+   *x = I2F( Rand(s) );
+   switch( Rand(s) % 4 )
+   {
+      case 0:
+         *y = I2F( Rand(s) );
+         break;
+
+      case 1:
+         *y = (float)((int)(Rand(s) % 200) - 100);
+         break;
+
+      case 2:
+         *y = (float)(int32_t)Rand(s) / (float)(1u << (Rand(s) % 31));
+         break;
+
+      default:
+         *y = I2F( (Rand(s) & 0x80000000) | (0x3E000000 + (Rand(s) % 0x02000000)) );
+         break;
+   }
+}
+
+static Worst Sweep2( const void *test, int p, int nproc )
+{
+   const Test2 *t = test;
+   Worst w = { 0, 0, 0 };
+   long ct = fullRun ? FULL_PAIR_CT : PAIR_CT;
+   uint64_t s = 88172645463325252ull + p;
+
+   for( long i=p; i<ct; i+=nproc )
+   {
+      float x, y;
+      Pair( &s, i, &x, &y );
+
+      double ref = t->ref( x, y );
+      if( !InDomain( t->dom, y, ref ) )
+         continue;
+      if( (t->dom == DOM_EXP) && !InDomain( DOM_LOG, x, ref ) )
+         continue;
+      if( !InDomain( t->dom, x, ref ) )
+         continue;
+
+      double e = UlpErr( t->f( x, y ), ref );
+      if( e > w.ulp )
+      {
+         w.ulp = e;
+         w.x = x;
+         w.y = y;
+      }
+   }
+   return w;
+}
+
+static double Now( void )
+{
+   struct timespec ts;
+   clock_gettime( CLOCK_MONOTONIC, &ts );
+   return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// Inputs for timing, spread evenly over a range.  Positive ranges
+// are spread evenly over the exponent.
+static void TimeInputs( float *in, float lo, float hi, uint64_t *s )
+{
+   for( int i=0; i<TIME_CT; i++ )
+   {
+      double u = (Rand(s) & 0xFFFFFF) / (double)0x1000000;
+      if( lo > 0 )
+         in[i] = exp2( log2(lo) + u * (log2(hi) - log2(lo)) );
+      else
+         in[i] = lo + u * (hi - lo);
+   }
+}
+
+static double Time1( const Test1 *t )
+{
+   static float in[ TIME_CT ];
+   uint64_t s = 1;
+   TimeInputs( in, t->lo, t->hi, &s );
+
+   volatile float sink = 0;
+   double t0 = Now();
+   for( int r=0; r<TIME_REPEAT; r++ )
+   {
+      for( int i=0; i<TIME_CT; i++ )
+         sink += t->f( in[i] );
+   }
+   return (Now() - t0) / ((double)TIME_CT * TIME_REPEAT);
+}
+
+static double Time2( const Test2 *t )
+{
+   static float x[ TIME_CT ], y[ TIME_CT ];
+   uint64_t s = 1;
+   TimeInputs( x, t->lo, t->hi, &s );
+   TimeInputs( y, -4.0f, 4.0f, &s );
+
+   volatile float sink = 0;
+   double t0 = Now();
+   for( int r=0; r<TIME_REPEAT; r++ )
+   {
+      for( int i=0; i<TIME_CT; i++ )
+         sink += t->f( x[i], y[i] );
+   }
+   return (Now() - t0) / ((double)TIME_CT * TIME_REPEAT);
+}
+
+int main( int argc, char *argv[] )
+{
+   const char *only = 0;
+   for( int i=1; i<argc; i++ )
+   {
+      if( !strcmp( argv[i], "-x" ) )
+         fullRun = 1;
+      else
+         only = argv[i];
+   }
+   setvbuf( stdout, 0, _IOLBF, 0 );
+
+   int bad = 0;
+
+   printf( "%s\n", fullRun ? "every float32 input" : "every 97th float32 input" );
+   for( unsigned i=0; i<ARRAY_CT(test1); i++ )
+   {
+      const Test1 *t = &test1[i];
+      if( only && strcmp( only, t->name ) )
+         continue;
+
+      Worst w = RunSplit( Sweep1, t );
+      int over = (w.ulp > t->limit);
+      printf( "  %-10s max %8.3f ULP at %-16a %6.2f ns/op%s\n",
+              t->name, w.ulp, w.x, Time1( t ), over ? "  OVER LIMIT" : "" );
+      bad += over;
+   }
+
+   printf( "%d sampled pairs\n", fullRun ? FULL_PAIR_CT : PAIR_CT );
+   for( unsigned i=0; i<ARRAY_CT(test2); i++ )
+   {
+      const Test2 *t = &test2[i];
+      if( only && strcmp( only, t->name ) )
+         continue;
+
+      Worst w = RunSplit( Sweep2, t );
+      int over = (w.ulp > t->limit);
+      printf( "  %-10s max %8.3f ULP at %a, %-16a %6.2f ns/op%s\n",
+              t->name, w.ulp, w.x, w.y, Time2( t ), over ? "  OVER LIMIT" : "" );
+      bad += over;
+   }
+   return bad ? 1 : 0;
+}
@@ -0,0 +1,202 @@
+/* sprintf_test.c */
+
+// Host test and benchmark for the float formatting in sprintf.c.
+//
+// sprintf.c is built with SPRINTF_TEST defined, which leaves out the
+// standard function names so the firmware's MYvsnprintf can be linked
+// next to the C library.  Its output for %f and %e is compared against
+// the C library's snprintf, which rounds the exact value of the float
+// the same way.
+//
+// The firmware doesn't pass floats through ..., since they would be
+// promoted to double.  They're passed as their bit patterns instead.
+//
+// Usage:
+//   sprintf_test         check a sample of values, then time a few formats
+//   sprintf_test -x      also check every positive float below 2^32 in
+//                        the most common formats.  This takes a while.
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+int MYvsnprintf( char *str, size_t size, const char *format, va_list ap );
+
+// Formats checked on the sampled values, including flags and widths
+static const char *sampleFmt[] =
+{
+   "%.0f", "%.1f", "%.2f", "%.3f", "%f", "%.9f", "%.12f",
+   "%e", "%.3e", "%.0e", "%+08.2f", "%-10.1f|", "% .4E", "%#.0f", "%#.0e", "%F",
+};
+
+// Formats checked against every float in the exhaustive run
+static const char *fullFmt[] = { "%.0f", "%.2f", "%f", "%e" };
+
+// Formats timed in the benchmark
+static const char *benchFmt[] = { "%.2f", "%f", "%e" };
+
+#define ARRAY_CT(x)      (sizeof(x)/sizeof(x[0]))
+#define MAX_SHOWN        10
+#define SAMPLE_CT        3000000
+#define BENCH_CT         100000
+#define BENCH_REPEAT     20
+
+static uint32_t F2I( float val ){ uint32_t u; memcpy( &u, &val, 4 ); return u; }
+static float I2F( uint32_t val ){ float f; memcpy( &f, &val, 4 ); return f; }
+
+static int FwPrintf( char *str, size_t size, const char *fmt, ... )
+{
+   va_list ap;
+   va_start( ap, fmt );
+   int ret = MYvsnprintf( str, size, fmt, ap );
+   va_end( ap );
+   return ret;
+}
+
+// Format one value both ways and compare.
+// Returns 1 if they differ.
+static int Check( uint32_t bits, const char *fmt )
+{
+   char ref[400], out[400];
+   int refLen = snprintf( ref, sizeof(ref), fmt, (double)I2F(bits) );
+   int outLen = FwPrintf( out, sizeof(out), fmt, bits );
+
+   if( (refLen == outLen) && !strcmp( ref, out ) )
+      return 0;
+
+   static int shown;
+   if( shown++ < MAX_SHOWN )
+      printf( "  %08x %-8s libc [%s] firmware [%s]\n", bits, fmt, ref, out );
+   return 1;
+}
+
+// Special values and random bit patterns, which cover the whole
+// range including NaN, infinity and denormals, in all the formats.
+static long CheckSample( void )
+{
+   static const uint32_t special[] =
+   {
+      0x00000000, 0x80000000, 0x7F800000, 0xFF800000, 0x7FC00000, 0xFFC00000,
+      0x7F7FFFFF, 0x00000001, 0x00800000, 0x3F000000, 0x3FC00000, 0x40200000,
+      0x3E800000, 0x3F7FFFFF, 0x4B7FFFFF, 0x4F7FFFFF, 0x4F800000,
+   };
+
+   long bad = 0;
+   for( unsigned i=0; i<ARRAY_CT(special); i++ )
+   {
+      for( unsigned f=0; f<ARRAY_CT(sampleFmt); f++ )
+         bad += Check( special[i], sampleFmt[f] );
+   }
+
+   srand( 1 );
+   for( long i=0; i<SAMPLE_CT; i++ )
+   {
+      uint32_t bits = ((uint32_t)rand() << 16) ^ (uint32_t)rand() ^ ((uint32_t)rand() << 31);
+      for( unsigned f=0; f<ARRAY_CT(sampleFmt); f++ )
+         bad += Check( bits, sampleFmt[f] );
+   }
+
+   printf( "sampled: %d values x %d formats, %ld differences\n",
+           SAMPLE_CT + (int)ARRAY_CT(special), (int)ARRAY_CT(sampleFmt), bad );
+   return bad;
+}
+
+// Every positive float below 2^32.  Negative values only add the sign.
+// The range is split between a process for each CPU.
+static long CheckFull( void )
+{
+   int nproc = sysconf( _SC_NPROCESSORS_ONLN );
+   if( nproc < 1 ) nproc = 1;
+
+   long total = 0;
+   for( unsigned f=0; f<ARRAY_CT(fullFmt); f++ )
+   {
+      int fd[2];
+      if( pipe( fd ) )
+         return 1;
+
+      for( int p=0; p<nproc; p++ )
+      {
+         if( fork() )
+            continue;
+
+         long bad = 0;
+         for( uint32_t bits=p; bits<0x4F800000; bits+=nproc )
+            bad += Check( bits, fullFmt[f] );
+
+         if( write( fd[1], &bad, sizeof(bad) ) != sizeof(bad) )
+            _exit( 1 );
+         _exit( 0 );
+      }
+      close( fd[1] );
+
+      long bad = 0, n;
+      while( read( fd[0], &n, sizeof(n) ) == sizeof(n) )
+         bad += n;
+      close( fd[0] );
+      while( wait( 0 ) > 0 );
+
+      printf( "exhaustive %-5s: %ld differences\n", fullFmt[f], bad );
+      total += bad;
+   }
+   return total;
+}
+
+static double Now( void )
+{
+   struct timespec ts;
+   clock_gettime( CLOCK_MONOTONIC, &ts );
+   return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// Time the firmware formatter and the C library on values like the
+// ones the firmware shows, a few digits either side of the point.
+static void Benchmark( void )
+{
+   static uint32_t vals[ BENCH_CT ];
+   char buff[64];
+
+   srand( 2 );
+   for( int i=0; i<BENCH_CT; i++ )
+      vals[i] = F2I( (rand() % 2000000) / 1000.0f - 1000.0f );
+
+   for( unsigned f=0; f<ARRAY_CT(benchFmt); f++ )
+   {
+      double t0 = Now();
+      for( int r=0; r<BENCH_REPEAT; r++ )
+      {
+         for( int i=0; i<BENCH_CT; i++ )
+            FwPrintf( buff, sizeof(buff), benchFmt[f], vals[i] );
+      }
+      double t1 = Now();
+      for( int r=0; r<BENCH_REPEAT; r++ )
+      {
+         for( int i=0; i<BENCH_CT; i++ )
+            snprintf( buff, sizeof(buff), benchFmt[f], (double)I2F(vals[i]) );
+      }
+      double t2 = Now();
+
+      double n = (double)BENCH_CT * BENCH_REPEAT;
+      printf( "%-5s firmware %6.1f ns/call   libc %6.1f ns/call\n",
+              benchFmt[f], (t1-t0)/n, (t2-t1)/n );
+   }
+}
+
+int main( int argc, char *argv[] )
+{
+   int full = (argc > 1) && !strcmp( argv[1], "-x" );
+
+   setvbuf( stdout, 0, _IOLBF, 0 );
+
+   long bad = CheckSample();
+   if( full )
+      bad += CheckFull();
+
+   Benchmark();
+   return bad ? 1 : 0;
+}
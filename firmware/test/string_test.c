@@ -0,0 +1,165 @@
+/* string_test.c */
+
+// Host test for the block functions in string.c.
+//
+// string.c is built with its memset, memcpy, memmove and memcmp renamed
+// (see the Makefile) so they can be checked against the C library's.
+// Every combination of source and destination alignment from 0 to 7
+// is run with every length from 0 to 99, which covers the byte head
+// and tail handling on both sides of the word loops.  Each operation
+// works in the middle of a larger buffer, and the whole buffer is
+// compared so writes outside the block are caught too.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+void *FwMemset( void *s, int c, int sz );
+void *FwMemcpy( void *dest, const void *src, int n );
+void *FwMemmove( void *dest, const void *src, int n );
+int FwMemcmp( const void *s1, const void *s2, int n );
+
+#define BUFF_LEN         256
+#define MAX_ALIGN        8
+#define MAX_LEN          100
+#define MAX_SHOWN        10
+
+// Block offset in the buffers.  Leaves room on either side for the
+// overlapping moves.
+#define BASE             64
+
+// Distances between the blocks for the overlapping moves, in both
+// directions, on top of the alignment offsets
+static const int moveGap[] = { 0, 4, 8, 16, 48 };
+
+// Buffers are aligned so the offsets give the alignments tested
+static uint8_t buff[ BUFF_LEN ] __attribute__(( aligned(8) ));
+static uint8_t other[ BUFF_LEN ] __attribute__(( aligned(8) ));
+static uint8_t ref[ BUFF_LEN ] __attribute__(( aligned(8) ));
+
+#define ARRAY_CT(x)      (sizeof(x)/sizeof(x[0]))
+
+static long tests, bad;
+
+static void Fill( uint8_t *p )
+{
+   for( int i=0; i<BUFF_LEN; i++ )
+      p[i] = rand();
+}
+
+static void Result( int ok, const char *func, int da, int sa, int n )
+{
+   tests++;
+   if( ok )
+      return;
+
+   if( bad++ < MAX_SHOWN )
+      printf( "  %s failed: dest align %d, src align %d, len %d\n", func, da, sa, n );
+}
+
+static void TestSet( int da, int n )
+{
+   static const int fill[] = { 0x00, 0x5A, 0xFF, 0x1A5, -1 };
+
+   for( unsigned i=0; i<ARRAY_CT(fill); i++ )
+   {
+      Fill( buff );
+      memcpy( ref, buff, BUFF_LEN );
+
+      memset( ref+BASE+da, fill[i], n );
+      void *ret = FwMemset( buff+BASE+da, fill[i], n );
+
+      Result( (ret == buff+BASE+da) && !memcmp( buff, ref, BUFF_LEN ), "memset", da, 0, n );
+   }
+}
+
+static void TestCopy( int da, int sa, int n )
+{
+   Fill( buff );
+   Fill( other );
+   memcpy( ref, buff, BUFF_LEN );
+
+   memcpy( ref+BASE+da, other+BASE+sa, n );
+   void *ret = FwMemcpy( buff+BASE+da, other+BASE+sa, n );
+
+   Result( (ret == buff+BASE+da) && !memcmp( buff, ref, BUFF_LEN ), "memcpy", da, sa, n );
+}
+
+// Moves within one buffer, with the source both before and after
+// the destination
+static void TestMove( int da, int sa, int n )
+{
+   for( unsigned g=0; g<ARRAY_CT(moveGap); g++ )
+   {
+      for( int dir=-1; dir<=1; dir+=2 )
+      {
+         int dst = BASE + da;
+         int src = BASE + sa + dir*moveGap[g];
+
+         Fill( buff );
+         memcpy( ref, buff, BUFF_LEN );
+
+         memmove( ref+dst, ref+src, n );
+         void *ret = FwMemmove( buff+dst, buff+src, n );
+
+         Result( (ret == buff+dst) && !memcmp( buff, ref, BUFF_LEN ), "memmove", da, sa, n );
+      }
+   }
+}
+
+static int Sign( int x )
+{
+   return (x > 0) - (x < 0);
+}
+
+// Equal blocks, then a single difference at each position.  The
+// firmware returns the difference of the first bytes that differ,
+// which has to have the same sign as the C library's result.
+static void TestCompare( int da, int sa, int n )
+{
+   Fill( other );
+   memcpy( buff+BASE+da, other+BASE+sa, n );
+   Result( !FwMemcmp( buff+BASE+da, other+BASE+sa, n ), "memcmp", da, sa, n );
+
+   for( int k=0; k<n; k++ )
+   {
+      memcpy( buff+BASE+da, other+BASE+sa, n );
+      buff[BASE+da+k] ^= 1 + rand() % 255;
+
+      // Bytes after the difference shouldn't matter
+      if( k+1 < n )
+         buff[BASE+da+k+1] = ~other[BASE+sa+k+1];
+
+      const uint8_t *p1 = buff+BASE+da;
+      const uint8_t *p2 = other+BASE+sa;
+      int ret = FwMemcmp( p1, p2, n );
+      int ok = (Sign(ret) == Sign( memcmp( p1, p2, n ) )) && (ret == p1[k] - p2[k]);
+
+      Result( ok, "memcmp", da, sa, n );
+   }
+}
+
+int main( void )
+{
+   srand( 3 );
+
+   for( int da=0; da<MAX_ALIGN; da++ )
+   {
+      for( int n=0; n<MAX_LEN; n++ )
+         TestSet( da, n );
+
+      for( int sa=0; sa<MAX_ALIGN; sa++ )
+      {
+         for( int n=0; n<MAX_LEN; n++ )
+         {
+            TestCopy( da, sa, n );
+            TestMove( da, sa, n );
+            TestCompare( da, sa, n );
+         }
+      }
+   }
+
+   printf( "string: %ld tests, %ld failures\n", tests, bad );
+   return bad ? 1 : 0;
+}
@@ -0,0 +1,266 @@
+#!/usr/bin/python
+
+from PIL import Image, ImageFont, ImageDraw
+import sys
+
+def main():
+   if( len(sys.argv) < 5 ):
+      print 'This utility is used to convert a TrueType font file'
+      print 'into a header file for use by my display'
+      print
+      print 'Usage: font_convert.py <font_file> <size> <header_file> <font_name> [options]'
+      print '  font_file   - the name of the font file to open'
+      print '  size        - size of the font to create in points'
+      print '  header_file - the name of the header file to create'
+      print '  font_name   - name of the font structure to write in the header'
+      print
+      print 'Options:'
+      print '  -rle        - compress the character bitmaps'
+      print '  -first=<c>  - first character to include, default space'
+      print '  -last=<c>   - last character to include, default ~'
+      print
+      print 'Note that on Linux systems you can usually find the'
+      print 'font files in /usr/share/fonts/truetype'
+      return
+   
+   font_file = sys.argv[1]
+   point_size = int(sys.argv[2])
+   header_name = sys.argv[3]
+   font_name = sys.argv[4]
+
+   rle = False
+   first = ' '
+   last = '~'
+   for opt in sys.argv[5:]:
+      if( opt == '-rle' ):
+         rle = True
+      elif( opt.startswith('-first=') ):
+         first = opt[7]
+      elif( opt.startswith('-last=') ):
+         last = opt[6]
+      else:
+         print 'Unknown option %s' % opt
+         return
+
+   # Load the font file and create a list of bitmapped characters
+   char_list = LoadFont( font_file, point_size, first, last )
+#   for c in char_list:
+#      print
+#      print c.ch
+#      c.Print()
+   
+   if( rle ):
+      for c in char_list:
+         c.Compress()
+
+   CreateHeader( header_name, font_name, font_file, point_size, char_list, rle )
+
+# Represents one character in the font
+class Char:
+   def __init__( self, ch, font ):
+      self.ch = ch;
+      self.size = font.getsize( ch )
+
+      M = font.getmetrics()
+      self.height = M[0]+M[1]
+
+      img = Image.new(mode='1', size=self.size, color=0)
+      d = ImageDraw.Draw(img)
+      d.text( (0,0), ch, font=font, fill=1 )
+
+      self.img = img
+      self.MakeBitmap( self.height )
+
+   # Create an array of byte values that hold the pixel data
+   # for this character.
+   # Pixels are stored in column order meaning that the first
+   # byte of the returned array holds the top 8 rows of the first
+   # column, the next byte hold the next 8 rows of that column,
+   # etc.
+   #
+   # Height is the total height of the font.
+   def MakeBitmap( self, height ):
+
+      # First, create an integer for each column
+      # of the font containing all the bits for that column
+      cols = []
+
+      for x in range(self.size[0]):
+         C = 0
+         mask = 1
+         for y in range(self.size[1]):
+            if( self.img.getpixel((x,y)) ):
+               C |= mask
+            mask <<= 1
+         cols.append(C)
+
+      # I don't store any initial zero columns
+      # rather I just keep track of how many there were
+      self.xoff = 0
+
+      for c in cols:
+         if( c ):
+            break
+         self.xoff += 1
+
+      cols = cols[self.xoff:]
+
+      # Discard any empty columns at the end of the font also
+      while( len(cols) ):
+         if( cols[-1] ):
+            break
+         cols = cols[:-1]
+
+      # Find how many bytes / column we will have
+      # based on the font height
+      bpc = (height+7)/8
+
+      self.bitmap = []
+      for c in cols:
+         col = []
+         for i in range(bpc):
+            col.append( c & 0xFF )
+            c >>= 8
+
+         # I reverse the order of the columns for 
+         # convenience in rendering the font
+         self.bitmap += col[::-1]
+
+   # Compress the bitmap.  The compressed data is stored by page rather
+   # than by column, top page first, since horizontal runs are more
+   # common than vertical ones within a page.  It starts with the
+   # number of columns, followed by runs encoded by a control byte:
+   #
+   #   00nnnnnn - n+1 literal bytes follow
+   #   01nnnnnn - n+1 bytes of 0x00
+   #   10nnnnnn - n+1 bytes of 0xFF
+   #   11nnnnnn - n+1 copies of the byte that follows
+   def Compress( self ):
+      bpc = (self.height+7)//8
+      cols = len(self.bitmap)//bpc
+
+      data = []
+      for p in range(bpc):
+         for c in range(cols):
+            data.append( self.bitmap[ c*bpc + bpc-1-p ] )
+
+      out = [ cols ]
+      lit = []
+      i = 0
+      while( i < len(data) ):
+         v = data[i]
+         n = 1
+         while( (i+n < len(data)) and (data[i+n] == v) and (n < 64) ):
+            n += 1
+
+         # Runs of 0x00 or 0xFF are worth it at two bytes,
+         # other values need three
+         if( (n >= 3) or ((n == 2) and (v in (0x00, 0xFF))) ):
+            out += RleLiteral( lit )
+            lit = []
+            if( v == 0x00 ):
+               out.append( 0x40 | (n-1) )
+            elif( v == 0xFF ):
+               out.append( 0x80 | (n-1) )
+            else:
+               out += [ 0xC0 | (n-1), v ]
+            i += n
+         else:
+            lit.append( v )
+            i += 1
+
+      out += RleLiteral( lit )
+
+      if( len(out) > 255 ):
+         raise Exception( 'Character %s is too large to compress' % self.ch )
+      self.bitmap = out
+
+   # Print the font out on the screen,
+   # mostly for debugging purposes
+   def Print( self ):
+      for y in range(self.size[1]):
+         S = '|'
+         for x in range(self.size[0]):
+            if( self.img.getpixel( (x,y) ) ):
+               S += '*'
+            else:
+               S += '.'
+         S += '|'
+         print S
+      for y in range(self.size[1],self.height):
+         S = '|'
+         for x in range(self.size[0]):
+            S += ' '
+         S += '|'
+         print S
+
+# Encode a list of literal bytes for the compressed bitmap
+def RleLiteral( lit ):
+   out = []
+   while( len(lit) ):
+      n = min( len(lit), 64 )
+      out += [ n-1 ] + lit[:n]
+      lit = lit[n:]
+   return out
+
+def LoadFont( font_file, point_size, first, last ):
+
+   font = ImageFont.truetype( font_file, size=point_size );
+
+   char_list = []
+
+   for i in range( ord(first), ord(last)+1 ):
+      char_list.append( Char( chr(i), font ) )
+
+   return char_list
+
+
+def CreateHeader( header_name, font_name, font_file, point_size, char_list, rle ):
+   fp = open( header_name, 'w' )
+
+   fp.write( '// Auto-generated font header\n' )
+   fp.write( '// Input font file: %s\n' % font_file )
+   fp.write( '// Font point size: %d\n' % point_size )
+   if( rle ):
+      fp.write( '// Compressed\n' )
+   fp.write( '\n' )
+
+   # Combine all the character bitmap data into one big
+   # list and add it to the header file
+   bitmap = []
+   for c in char_list:
+      bitmap += c.bitmap
+
+   S = 'static const uint8_t %s_bitmap[] = {' % font_name
+
+   for i in range(len(bitmap)):
+      if( i & 0xF == 0 ):
+         fp.write( S + '\n' )
+         S = '   '
+      S += '0x%02x, ' % bitmap[i]
+
+   S = S.rstrip()
+   if( S[-1] == ',' ):
+      S = S[:-1] + ' '
+
+   fp.write( S + '};\n\n' )
+
+   fp.write( 'static const FontChar %s_chars[] = {\n' % font_name )
+   off = 0;
+   for i in range(len(char_list)):
+      c = char_list[i]
+      fp.write( "   { %4d, %2d, %2d, %2d },      // '%c'\n" % (off, len(c.bitmap), c.xoff, c.size[0], c.ch  ) )
+      off += len(c.bitmap)
+
+   fp.write( '};\n\n' )
+
+   start = ord(char_list[0].ch)
+   end = ord(char_list[-1].ch)
+   height = char_list[0].height
+   if( rle ):
+      fp.write( 'static const FontInfo %s = { %s_bitmap, %s_chars, %d, %d, %d, FONT_FLG_RLE };\n' % (font_name, font_name, font_name, height, start, end) )
+   else:
+      fp.write( 'static const FontInfo %s = { %s_bitmap, %s_chars, %d, %d, %d };\n' % (font_name, font_name, font_name, height, start, end) )
+   fp.close()
+
+main()